@@ -1,11 +1,24 @@
 #ifndef S21_CONTAINERS_CPP_H
 #define S21_CONTAINERS_CPP_H
 
+#include "source/huge_page_allocator.h"
+#include "source/s21_algorithm.h"
+#include "source/s21_bit_vector.h"
+#include "source/s21_concurrent_vector.h"
+#include "source/s21_cow_vector.h"
+#include "source/s21_intrusive_list.h"
 #include "source/s21_list.h"
 #include "source/s21_map.h"
+#include "source/s21_mmap_vector.h"
+#include "source/s21_parallel.h"
 #include "source/s21_queue.h"
 #include "source/s21_set.h"
+#include "source/s21_slot_map.h"
+#include "source/s21_small_vector.h"
+#include "source/s21_soa_vector.h"
+#include "source/s21_span.h"
 #include "source/s21_stack.h"
+#include "source/s21_unrolled_list.h"
 #include "source/s21_vector.h"
 
 #endif
\ No newline at end of file
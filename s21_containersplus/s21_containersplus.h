@@ -2,6 +2,7 @@
 #define S21_CONTAINERS_PLUS_CPP_H
 
 #include "source/s21_array.h"
+#include "source/s21_inplace_vector.h"
 #include "source/s21_multiset.h"
 
 #endif
\ No newline at end of file
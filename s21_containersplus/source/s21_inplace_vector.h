@@ -0,0 +1,270 @@
+#ifndef S21_INPLACE_VECTOR_H
+#define S21_INPLACE_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// vector with a fixed capacity of N elements stored inside the object; it
+// never allocates. Growing past N throws std::length_error and leaves the
+// container unchanged; try_push_back / try_emplace_back return nullptr
+// instead. Bad positions throw std::out_of_range.
+template <typename T, std::size_t N>
+class inplace_vector {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using size_type = std::size_t;
+
+ private:
+  size_type size_;
+  alignas(T) unsigned char storage_[sizeof(T) * (N == 0 ? 1 : N)];
+
+ public:
+  inplace_vector() : size_(0) {}
+
+  explicit inplace_vector(size_type n) : inplace_vector() { resize(n); }
+
+  inplace_vector(size_type n, const_reference value) : inplace_vector() {
+    resize(n, value);
+  }
+
+  inplace_vector(std::initializer_list<value_type> il) : inplace_vector() {
+    check_room(il.size());
+    for (const auto& item : il) unchecked_emplace_back(item);
+  }
+
+  inplace_vector(const inplace_vector& other) : inplace_vector() {
+    for (const auto& item : other) unchecked_emplace_back(item);
+  }
+
+  inplace_vector(inplace_vector&& other) noexcept(
+      std::is_nothrow_move_constructible_v<T>)
+      : inplace_vector() {
+    for (auto& item : other) unchecked_emplace_back(std::move(item));
+  }
+
+  ~inplace_vector() { clear(); }
+
+  inplace_vector& operator=(const inplace_vector& other) {
+    if (this != &other) assign_from(other.begin(), other.end());
+    return *this;
+  }
+
+  inplace_vector& operator=(inplace_vector&& other) noexcept(
+      std::is_nothrow_move_assignable_v<T>&&
+          std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other) {
+      assign_from(std::make_move_iterator(other.begin()),
+                  std::make_move_iterator(other.end()));
+    }
+    return *this;
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("Index out of range");
+    return data()[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Index out of range");
+    return data()[pos];
+  }
+
+  reference operator[](size_type pos) { return data()[pos]; }
+
+  const_reference operator[](size_type pos) const { return data()[pos]; }
+
+  reference front() { return data()[0]; }
+
+  const_reference front() const { return data()[0]; }
+
+  reference back() { return data()[size_ - 1]; }
+
+  const_reference back() const { return data()[size_ - 1]; }
+
+  iterator data() { return reinterpret_cast<T*>(storage_); }
+
+  const_iterator data() const { return reinterpret_cast<const T*>(storage_); }
+
+  iterator begin() { return data(); }
+
+  const_iterator begin() const { return data(); }
+
+  iterator end() { return data() + size_; }
+
+  const_iterator end() const { return data() + size_; }
+
+  const_iterator cbegin() const { return data(); }
+
+  const_iterator cend() const { return data() + size_; }
+
+  bool empty() const { return size_ == 0; }
+
+  bool full() const { return size_ == N; }
+
+  size_type size() const { return size_; }
+
+  static constexpr size_type max_size() { return N; }
+
+  static constexpr size_type capacity() { return N; }
+
+  void resize(size_type count) { resize_with(count); }
+
+  void resize(size_type count, const_reference value) {
+    resize_with(count, value);
+  }
+
+  void clear() noexcept {
+    std::destroy(begin(), end());
+    size_ = 0;
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, T&& value) {
+    return emplace(pos, std::move(value));
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args) {
+    if (pos < cbegin() || pos > cend()) {
+      throw std::out_of_range("Invalid pos of value");
+    }
+    check_room(1);
+    size_type index = static_cast<size_type>(pos - cbegin());
+    unchecked_emplace_back(std::forward<Args>(args)...);
+    std::rotate(begin() + index, end() - 1, end());
+    return begin() + index;
+  }
+
+  void erase(const_iterator pos) {
+    if (pos < cbegin() || pos >= cend()) {
+      throw std::out_of_range("Invalid iterator");
+    }
+    erase(pos, pos + 1);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    if (first < cbegin() || first > last || last > cend()) {
+      throw std::out_of_range("Invalid iterator");
+    }
+    size_type index = static_cast<size_type>(first - cbegin());
+    size_type count = static_cast<size_type>(last - first);
+    if (count != 0) {
+      std::move(begin() + index + count, end(), begin() + index);
+      std::destroy(end() - count, end());
+      size_ -= count;
+    }
+    return begin() + index;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(T&& value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    check_room(1);
+    return unchecked_emplace_back(std::forward<Args>(args)...);
+  }
+
+  // Returns nullptr instead of throwing when the vector is full.
+  T* try_push_back(const_reference value) { return try_emplace_back(value); }
+
+  T* try_push_back(T&& value) { return try_emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  T* try_emplace_back(Args&&... args) {
+    if (full()) return nullptr;
+    return &unchecked_emplace_back(std::forward<Args>(args)...);
+  }
+
+  void pop_back() {
+    if (size_ > 0) {
+      --size_;
+      std::destroy_at(end());
+    }
+  }
+
+  void swap(inplace_vector& other) {
+    inplace_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+  // Appends all arguments or, if they do not fit, none of them.
+  template <typename... Args>
+  void insert_many_back(Args&&... args) {
+    check_room(sizeof...(args));
+    size_type old_size = size_;
+    try {
+      (unchecked_emplace_back(std::forward<Args>(args)), ...);
+    } catch (...) {
+      while (size_ > old_size) pop_back();
+      throw;
+    }
+  }
+
+  bool operator==(const inplace_vector& other) const {
+    return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+  }
+
+  bool operator!=(const inplace_vector& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  void check_room(size_type count) const {
+    if (count > N - size_) {
+      throw std::length_error("inplace_vector capacity exceeded");
+    }
+  }
+
+  template <typename... Args>
+  reference unchecked_emplace_back(Args&&... args) {
+    T* slot = ::new (static_cast<void*>(data() + size_))
+        T(std::forward<Args>(args)...);
+    ++size_;
+    return *slot;
+  }
+
+  template <typename... Args>
+  void resize_with(size_type count, const Args&... args) {
+    if (count > N) {
+      throw std::length_error("inplace_vector capacity exceeded");
+    }
+    while (size_ > count) pop_back();
+    size_type old_size = size_;
+    try {
+      while (size_ < count) unchecked_emplace_back(args...);
+    } catch (...) {
+      while (size_ > old_size) pop_back();
+      throw;
+    }
+  }
+
+  template <typename It>
+  void assign_from(It first, It last) {
+    size_type i = 0;
+    for (; first != last && i < size_; ++first, ++i) data()[i] = *first;
+    while (size_ > i) pop_back();
+    for (; first != last; ++first) unchecked_emplace_back(*first);
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_INPLACE_VECTOR_H
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(InplaceVectorMemberFunctions, TestDefault) {
+  s21::inplace_vector<int, 4> v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.size(), 0U);
+  EXPECT_EQ(v.capacity(), 4U);
+  EXPECT_EQ(v.max_size(), 4U);
+}
+
+TEST(InplaceVectorMemberFunctions, TestInitializer) {
+  s21::inplace_vector<int, 4> v = {1, 2, 3};
+  EXPECT_EQ(v.size(), 3U);
+  EXPECT_EQ(v.front(), 1);
+  EXPECT_EQ(v.back(), 3);
+  EXPECT_THROW((s21::inplace_vector<int, 2>{1, 2, 3}), std::length_error);
+}
+
+TEST(InplaceVectorMemberFunctions, TestCopyMove) {
+  s21::inplace_vector<std::string, 3> a = {"a", "b"};
+  s21::inplace_vector<std::string, 3> b = a;
+  EXPECT_TRUE(a == b);
+  s21::inplace_vector<std::string, 3> c = std::move(b);
+  EXPECT_TRUE(a == c);
+  s21::inplace_vector<std::string, 3> d = {"x", "y", "z"};
+  d = a;
+  EXPECT_TRUE(a == d);
+  d = {"q"};
+  EXPECT_EQ(d.size(), 1U);
+  EXPECT_EQ(d[0], "q");
+}
+
+TEST(InplaceVectorModifiers, TestPushBackOverflow) {
+  s21::inplace_vector<std::string, 2> v;
+  v.push_back("a");
+  v.emplace_back(3U, 'b');
+  EXPECT_TRUE(v.full());
+  EXPECT_THROW(v.push_back("c"), std::length_error);
+  EXPECT_EQ(v.size(), 2U);
+  EXPECT_EQ(v[1], "bbb");
+  EXPECT_EQ(v.try_push_back("c"), nullptr);
+  v.pop_back();
+  std::string *added = v.try_push_back("c");
+  ASSERT_NE(added, nullptr);
+  EXPECT_EQ(*added, "c");
+}
+
+TEST(InplaceVectorModifiers, TestInsertErase) {
+  s21::inplace_vector<int, 5> v = {1, 2, 4};
+  auto it = v.insert(v.begin() + 2, 3);
+  EXPECT_EQ(*it, 3);
+  v.insert(v.begin(), 0);
+  EXPECT_TRUE((v == s21::inplace_vector<int, 5>{0, 1, 2, 3, 4}));
+  EXPECT_THROW(v.insert(v.begin(), 9), std::length_error);
+  EXPECT_THROW(v.at(5), std::out_of_range);
+  v.erase(v.begin());
+  it = v.erase(v.begin() + 1, v.begin() + 3);
+  EXPECT_EQ(*it, 4);
+  EXPECT_TRUE((v == s21::inplace_vector<int, 5>{1, 4}));
+  EXPECT_THROW(v.erase(v.end()), std::out_of_range);
+  EXPECT_THROW(v.insert(v.end() + 1, 0), std::out_of_range);
+}
+
+TEST(InplaceVectorModifiers, TestResize) {
+  s21::inplace_vector<std::string, 4> v(2, "x");
+  v.resize(4, "y");
+  EXPECT_EQ(v[3], "y");
+  v.resize(1);
+  EXPECT_EQ(v.size(), 1U);
+  EXPECT_THROW(v.resize(5), std::length_error);
+  EXPECT_EQ(v.size(), 1U);
+  v.clear();
+  EXPECT_TRUE(v.empty());
+}
+
+TEST(InplaceVectorModifiers, TestInsertManyBack) {
+  s21::inplace_vector<int, 4> v = {1};
+  v.insert_many_back(2, 3);
+  EXPECT_EQ(v.size(), 3U);
+  EXPECT_THROW(v.insert_many_back(4, 5), std::length_error);
+  EXPECT_EQ(v.size(), 3U);
+}
+
+TEST(InplaceVectorModifiers, TestSwap) {
+  s21::inplace_vector<std::string, 3> a = {"a"};
+  s21::inplace_vector<std::string, 3> b = {"b", "c"};
+  a.swap(b);
+  EXPECT_EQ(a.size(), 2U);
+  EXPECT_EQ(b[0], "a");
+}
@@ -0,0 +1,49 @@
+#ifndef GROWTH_POLICY_H
+#define GROWTH_POLICY_H
+
+#include <algorithm>
+#include <cstddef>
+
+namespace s21 {
+
+// A growth policy maps the current capacity and the number of elements that
+// must fit to the capacity a container should reallocate to. The result may
+// be smaller than required; containers clamp it.
+
+struct doubling_growth {
+  static std::size_t next_capacity(std::size_t capacity, std::size_t required,
+                                   std::size_t) {
+    return std::max(required, capacity == 0 ? 1 : 2 * capacity);
+  }
+};
+
+struct one_and_half_growth {
+  static std::size_t next_capacity(std::size_t capacity, std::size_t required,
+                                   std::size_t) {
+    return std::max(required, capacity + (capacity + 1) / 2);
+  }
+};
+
+// Grows by 1.5x and then rounds the byte size up to a malloc-style size
+// class (16 byte steps up to 128, then four classes per power of two), so
+// the slack the allocator would waste anyway becomes usable capacity.
+struct size_class_growth {
+  static std::size_t next_capacity(std::size_t capacity, std::size_t required,
+                                   std::size_t value_size) {
+    std::size_t count = one_and_half_growth::next_capacity(capacity, required,
+                                                           value_size);
+    return round_bytes(count * value_size) / value_size;
+  }
+
+  static std::size_t round_bytes(std::size_t bytes) {
+    if (bytes <= 128) return (bytes + 15) / 16 * 16;
+    std::size_t power = 128;
+    while (power < bytes / 2) power *= 2;
+    std::size_t step = power / 4;
+    return (bytes + step - 1) / step * step;
+  }
+};
+
+}  // namespace s21
+
+#endif  // GROWTH_POLICY_H
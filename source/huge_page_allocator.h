@@ -0,0 +1,141 @@
+#ifndef S21_HUGE_PAGE_ALLOCATOR_H
+#define S21_HUGE_PAGE_ALLOCATOR_H
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+namespace huge_pages {
+// Flags for huge_page_allocator.
+enum flags : unsigned {
+  none = 0,
+  // Fault every page in at allocation time instead of on first touch.
+  populate = 1,
+  // mlock the allocation. Implies populate; counts against RLIMIT_MEMLOCK.
+  lock = 2,
+};
+
+constexpr std::size_t page_size = std::size_t{2} << 20;
+}  // namespace huge_pages
+
+// Allocator for large arrays. Requests of at least one huge page come
+// straight from mmap, aligned to 2MB and rounded up to whole huge pages,
+// and are marked MADV_HUGEPAGE so transparent huge pages back them even
+// when the system only enables THP on request. Smaller requests go to
+// std::allocator. Use it with any allocator-aware container, e.g.
+// vector<T, huge_page_allocator<T>> (see huge_page_vector).
+template <typename T, unsigned Flags = huge_pages::none>
+class huge_page_allocator {
+ public:
+  using value_type = T;
+  using is_always_equal = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = huge_page_allocator<U, Flags>;
+  };
+
+  huge_page_allocator() noexcept = default;
+
+  template <typename U>
+  huge_page_allocator(const huge_page_allocator<U, Flags> &) noexcept {}
+
+  T *allocate(std::size_t n) {
+    if (n > max_size()) throw std::bad_array_new_length();
+    if (!use_huge_pages(n)) return std::allocator<T>().allocate(n);
+    std::size_t length = mapped_length(n);
+    void *p = map_aligned(length);
+    if ((Flags & (huge_pages::populate | huge_pages::lock)) != 0) {
+      if (!prefault(p, length)) {
+        ::munmap(p, length);
+        throw std::bad_alloc();
+      }
+    }
+    return static_cast<T *>(p);
+  }
+
+  void deallocate(T *p, std::size_t n) noexcept {
+    if (!use_huge_pages(n)) {
+      std::allocator<T>().deallocate(p, n);
+    } else {
+      ::munmap(p, mapped_length(n));
+    }
+  }
+
+  static constexpr std::size_t max_size() noexcept {
+    return (std::size_t(-1) - huge_pages::page_size) / sizeof(T);
+  }
+
+  template <typename U>
+  bool operator==(const huge_page_allocator<U, Flags> &) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const huge_page_allocator<U, Flags> &) const noexcept {
+    return false;
+  }
+
+ private:
+  static bool use_huge_pages(std::size_t n) noexcept {
+    return n * sizeof(T) >= huge_pages::page_size;
+  }
+
+  static std::size_t mapped_length(std::size_t n) noexcept {
+    constexpr std::size_t mask = huge_pages::page_size - 1;
+    return (n * sizeof(T) + mask) & ~mask;
+  }
+
+  // mmap aligns to the base page only, so one extra huge page is mapped and
+  // the misaligned head and the tail are returned.
+  static void *map_aligned(std::size_t length) {
+    std::size_t padded = length + huge_pages::page_size;
+    void *raw = ::mmap(nullptr, padded, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) throw std::bad_alloc();
+    auto begin = reinterpret_cast<std::uintptr_t>(raw);
+    auto aligned = (begin + huge_pages::page_size - 1) &
+                   ~std::uintptr_t{huge_pages::page_size - 1};
+    std::size_t head = aligned - begin;
+    if (head != 0) ::munmap(raw, head);
+    std::size_t tail = padded - head - length;
+    if (tail != 0) {
+      ::munmap(reinterpret_cast<void *>(aligned + length), tail);
+    }
+    void *p = reinterpret_cast<void *>(aligned);
+    ::madvise(p, length, MADV_HUGEPAGE);
+    return p;
+  }
+
+  // The pages are faulted in after madvise, so they come in as huge pages;
+  // MAP_POPULATE would fault them in before the advice is set.
+  static bool prefault(void *p, std::size_t length) noexcept {
+    if ((Flags & huge_pages::lock) != 0) return ::mlock(p, length) == 0;
+#ifdef MADV_POPULATE_WRITE
+    if (::madvise(p, length, MADV_POPULATE_WRITE) == 0) return true;
+    if (errno != EINVAL) return false;
+#endif
+    std::size_t step = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    for (std::size_t i = 0; i < length; i += step) {
+      static_cast<volatile unsigned char *>(p)[i] = 0;
+    }
+    return true;
+  }
+};
+
+template <typename T, unsigned Flags = huge_pages::none>
+using huge_page_vector = vector<T, huge_page_allocator<T, Flags>>;
+
+}  // namespace s21
+
+#endif  // S21_HUGE_PAGE_ALLOCATOR_H
@@ -0,0 +1,187 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace s21 {
+
+// Slab allocator for fixed-size nodes. Memory comes in chunks that start
+// small and double in size up to chunk_bytes, so a pool holding a handful of
+// nodes stays small. Every chunk is aligned to chunk_bytes, so the chunk a
+// node belongs to is found by masking its address. Freed nodes go onto an
+// intrusive free list and are handed out again before a chunk is cut
+// further.
+//
+// Node-based containers exchange nodes (splice, merge, swap), so a node may
+// be freed into a pool other than the one it came from. Every chunk
+// therefore keeps an atomic reference count: one for its pool plus one per
+// node that is live or parked in another pool's free list. A pool destroyed
+// while some of its nodes are still out leaves those chunks behind as
+// orphans, and the last node returned frees the chunk. The counts are the
+// only state pools share, so containers that have exchanged nodes can still
+// be used from different threads.
+template <typename T>
+class node_pool {
+ public:
+  using size_type = size_t;
+
+ private:
+  struct chunk {
+    chunk(node_pool *o, chunk *n) : owner(o), refs(1), next(n) {}
+
+    std::atomic<node_pool *> owner;  // nullptr once the pool is gone
+    std::atomic<size_type> refs;
+    chunk *next;  // only touched by the owner
+  };
+
+  struct free_slot {
+    free_slot *next;
+  };
+
+  static constexpr size_type round_up(size_type n, size_type to) {
+    return (n + to - 1) / to * to;
+  }
+
+  static constexpr size_type power_of_two_at_least(size_type n) {
+    size_type p = 1;
+    while (p < n) p *= 2;
+    return p;
+  }
+
+  static constexpr size_type slot_align =
+      std::max(alignof(T), alignof(free_slot));
+  static constexpr size_type slot_size =
+      round_up(std::max(sizeof(T), sizeof(free_slot)), slot_align);
+  static constexpr size_type header_size = round_up(sizeof(chunk), slot_align);
+
+ public:
+  // Size of the largest chunk and alignment of every chunk.
+  static constexpr size_type chunk_bytes =
+      power_of_two_at_least(std::max<size_type>(4096, header_size +
+                                                          32 * slot_size));
+  static constexpr size_type nodes_per_chunk =
+      (chunk_bytes - header_size) / slot_size;
+  static constexpr size_type first_chunk_nodes =
+      std::min<size_type>(4, nodes_per_chunk);
+
+  node_pool()
+      : free_(nullptr),
+        free_count_(0),
+        bump_(nullptr),
+        bump_end_(nullptr),
+        chunks_(nullptr),
+        chunk_count_(0),
+        next_chunk_nodes_(first_chunk_nodes) {}
+
+  node_pool(const node_pool &) = delete;
+  node_pool &operator=(const node_pool &) = delete;
+
+  ~node_pool() {
+    for (free_slot *slot = free_; slot;) {
+      free_slot *next = slot->next;
+      chunk *c = chunk_of(slot);
+      if (c->owner.load(std::memory_order_relaxed) != this) unref(c);
+      slot = next;
+    }
+    for (chunk *c = chunks_; c;) {
+      chunk *next = c->next;
+      c->owner.store(nullptr, std::memory_order_release);
+      unref(c);
+      c = next;
+    }
+  }
+
+  // Uninitialized storage for one T.
+  T *allocate() {
+    if (free_) {
+      free_slot *slot = free_;
+      free_ = slot->next;
+      --free_count_;
+      chunk *c = chunk_of(slot);
+      // A parked foreign node is still counted by its chunk.
+      if (c->owner.load(std::memory_order_relaxed) == this) {
+        c->refs.fetch_add(1, std::memory_order_relaxed);
+      }
+      return reinterpret_cast<T *>(slot);
+    }
+    if (bump_ == bump_end_) add_chunk(next_chunk_nodes_);
+    unsigned char *p = bump_;
+    bump_ += slot_size;
+    chunk_of(p)->refs.fetch_add(1, std::memory_order_relaxed);
+    return reinterpret_cast<T *>(p);
+  }
+
+  // p must come from allocate() of this or any other node_pool<T>, and the
+  // T in it must already be destroyed.
+  void deallocate(T *p) noexcept {
+    chunk *c = chunk_of(p);
+    node_pool *owner = c->owner.load(std::memory_order_acquire);
+    if (!owner) {
+      unref(c);
+      return;
+    }
+    // The pool's own reference keeps the count above zero here.
+    if (owner == this) c->refs.fetch_sub(1, std::memory_order_relaxed);
+    free_ = ::new (static_cast<void *>(p)) free_slot{free_};
+    ++free_count_;
+  }
+
+  // Makes sure the next n allocations need no new chunk.
+  void reserve(size_type n) {
+    while (available() < n) {
+      while (bump_ != bump_end_) {
+        free_ = ::new (static_cast<void *>(bump_)) free_slot{free_};
+        ++free_count_;
+        bump_ += slot_size;
+      }
+      add_chunk(std::max(next_chunk_nodes_, n - available()));
+    }
+  }
+
+  // Nodes that can be handed out without allocating a chunk.
+  size_type available() const {
+    return free_count_ + static_cast<size_type>(bump_end_ - bump_) / slot_size;
+  }
+
+  size_type chunk_count() const { return chunk_count_; }
+
+ private:
+  static chunk *chunk_of(const void *p) {
+    auto address = reinterpret_cast<std::uintptr_t>(p);
+    return reinterpret_cast<chunk *>(address & ~(chunk_bytes - 1));
+  }
+
+  void add_chunk(size_type nodes) {
+    nodes = std::min(nodes, nodes_per_chunk);
+    void *memory = ::operator new(header_size + nodes * slot_size,
+                                  std::align_val_t(chunk_bytes));
+    chunks_ = ::new (memory) chunk(this, chunks_);
+    ++chunk_count_;
+    bump_ = static_cast<unsigned char *>(memory) + header_size;
+    bump_end_ = bump_ + nodes * slot_size;
+    next_chunk_nodes_ = std::min(nodes * 2, nodes_per_chunk);
+  }
+
+  static void unref(chunk *c) noexcept {
+    if (c->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      c->~chunk();
+      ::operator delete(static_cast<void *>(c), std::align_val_t(chunk_bytes));
+    }
+  }
+
+  free_slot *free_;
+  size_type free_count_;
+  unsigned char *bump_;
+  unsigned char *bump_end_;
+  chunk *chunks_;
+  size_type chunk_count_;
+  size_type next_chunk_nodes_;
+};
+
+}  // namespace s21
+
+#endif  // NODE_POOL_H
@@ -0,0 +1,414 @@
+#ifndef S21_ALGORITHM_H
+#define S21_ALGORITHM_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+#include "simd.h"
+
+namespace s21 {
+// Search and fill algorithms for contiguous ranges. Pointer ranges of
+// arithmetic types go through the runtime-dispatched SIMD kernels in
+// simd.h; anything else falls back to the std algorithm. The container
+// overloads accept anything with data() and size() (vector, array, span,
+// ...), including temporaries such as span(v).first(n).
+
+template <typename T, typename U>
+T *find(T *first, T *last, const U &value) {
+  using value_type = std::remove_cv_t<T>;
+  if constexpr (simd::is_vectorizable<value_type>::value &&
+                std::is_same_v<value_type, U>) {
+    return first + (simd::find<value_type>(first, last, value) - first);
+  } else {
+    return std::find(first, last, value);
+  }
+}
+
+template <typename T, typename U>
+std::size_t count(T *first, T *last, const U &value) {
+  using value_type = std::remove_cv_t<T>;
+  if constexpr (simd::is_vectorizable<value_type>::value &&
+                std::is_same_v<value_type, U>) {
+    return simd::count<value_type>(first, last, value);
+  } else {
+    return static_cast<std::size_t>(std::count(first, last, value));
+  }
+}
+
+template <typename T, typename U>
+bool contains(T *first, T *last, const U &value) {
+  return s21::find(first, last, value) != last;
+}
+
+template <typename T>
+T *min_element(T *first, T *last) {
+  using value_type = std::remove_cv_t<T>;
+  if constexpr (simd::is_vectorizable<value_type>::value) {
+    return first + (simd::min_element<value_type>(first, last) - first);
+  } else {
+    return std::min_element(first, last);
+  }
+}
+
+template <typename T>
+T *max_element(T *first, T *last) {
+  using value_type = std::remove_cv_t<T>;
+  if constexpr (simd::is_vectorizable<value_type>::value) {
+    return first + (simd::max_element<value_type>(first, last) - first);
+  } else {
+    return std::max_element(first, last);
+  }
+}
+
+template <typename T, typename U>
+bool equal(T *first1, T *last1, U *first2) {
+  using value_type = std::remove_cv_t<T>;
+  if constexpr (simd::is_vectorizable<value_type>::value &&
+                std::is_same_v<value_type, std::remove_cv_t<U>>) {
+    return simd::equal<value_type>(first1, last1, first2);
+  } else {
+    return std::equal(first1, last1, first2);
+  }
+}
+
+template <typename T, typename U>
+void fill(T *first, T *last, const U &value) {
+  if constexpr (simd::is_vectorizable<T>::value && std::is_same_v<T, U>) {
+    simd::fill(first, last, value);
+  } else {
+    std::fill(first, last, value);
+  }
+}
+
+template <typename Container>
+using require_contiguous = decltype(std::declval<Container &>().data(),
+                                    std::declval<Container &>().size(),
+                                    void());
+
+template <typename Container, typename U,
+          typename = require_contiguous<Container>>
+auto find(Container &&c, const U &value) -> decltype(c.begin()) {
+  auto first = c.data();
+  return c.begin() + (s21::find(first, first + c.size(), value) - first);
+}
+
+template <typename Container, typename U,
+          typename = require_contiguous<Container>>
+std::size_t count(Container &&c, const U &value) {
+  return s21::count(c.data(), c.data() + c.size(), value);
+}
+
+template <typename Container, typename U,
+          typename = require_contiguous<Container>>
+bool contains(Container &&c, const U &value) {
+  return s21::contains(c.data(), c.data() + c.size(), value);
+}
+
+template <typename Container, typename = require_contiguous<Container>>
+auto min_element(Container &&c) -> decltype(c.begin()) {
+  auto first = c.data();
+  return c.begin() + (s21::min_element(first, first + c.size()) - first);
+}
+
+template <typename Container, typename = require_contiguous<Container>>
+auto max_element(Container &&c) -> decltype(c.begin()) {
+  auto first = c.data();
+  return c.begin() + (s21::max_element(first, first + c.size()) - first);
+}
+
+template <typename Container1, typename Container2,
+          typename = require_contiguous<Container1>,
+          typename = require_contiguous<Container2>>
+bool equal(Container1 &&a, Container2 &&b) {
+  return a.size() == b.size() &&
+         s21::equal(a.data(), a.data() + a.size(), b.data());
+}
+
+template <typename Container, typename U,
+          typename = require_contiguous<Container>>
+void fill(Container &&c, const U &value) {
+  s21::fill(c.data(), c.data() + c.size(), value);
+}
+
+namespace detail {
+
+template <typename T, typename Compare>
+void insertion_sort(T *first, T *last, Compare &comp) {
+  if (first == last) return;
+  for (T *i = first + 1; i != last; ++i) {
+    T tmp = std::move(*i);
+    T *j = i;
+    for (; j != first && comp(tmp, *(j - 1)); --j) *j = std::move(*(j - 1));
+    *j = std::move(tmp);
+  }
+}
+
+template <typename T, typename Compare>
+void move_median_to_first(T *result, T *a, T *b, T *c, Compare &comp) {
+  if (comp(*a, *b)) {
+    if (comp(*b, *c)) {
+      std::iter_swap(result, b);
+    } else if (comp(*a, *c)) {
+      std::iter_swap(result, c);
+    } else {
+      std::iter_swap(result, a);
+    }
+  } else if (comp(*a, *c)) {
+    std::iter_swap(result, a);
+  } else if (comp(*b, *c)) {
+    std::iter_swap(result, c);
+  } else {
+    std::iter_swap(result, b);
+  }
+}
+
+constexpr std::ptrdiff_t insertion_sort_threshold = 16;
+
+// Quicksort with a median-of-three pivot that switches to heapsort once the
+// recursion gets deeper than depth. Leaves runs shorter than the threshold
+// unsorted for the final insertion sort.
+template <typename T, typename Compare>
+void introsort_loop(T *first, T *last, std::size_t depth, Compare &comp) {
+  while (last - first > insertion_sort_threshold) {
+    if (depth == 0) {
+      std::make_heap(first, last, comp);
+      std::sort_heap(first, last, comp);
+      return;
+    }
+    --depth;
+    move_median_to_first(first, first + 1, first + (last - first) / 2,
+                         last - 1, comp);
+    T *lo = first + 1;
+    T *hi = last;
+    while (true) {
+      while (comp(*lo, *first)) ++lo;
+      --hi;
+      while (comp(*first, *hi)) --hi;
+      if (!(lo < hi)) break;
+      std::iter_swap(lo, hi);
+      ++lo;
+    }
+    introsort_loop(lo, last, depth, comp);
+    last = lo;
+  }
+}
+
+template <typename T, typename Compare>
+void merge_move(T *first1, T *last1, T *first2, T *last2, T *out,
+                Compare &comp) {
+  while (first1 != last1 && first2 != last2) {
+    if (comp(*first2, *first1)) {
+      *out++ = std::move(*first2++);
+    } else {
+      *out++ = std::move(*first1++);
+    }
+  }
+  out = std::move(first1, last1, out);
+  std::move(first2, last2, out);
+}
+
+template <std::size_t Size>
+struct unsigned_of;
+template <>
+struct unsigned_of<1> {
+  using type = std::uint8_t;
+};
+template <>
+struct unsigned_of<2> {
+  using type = std::uint16_t;
+};
+template <>
+struct unsigned_of<4> {
+  using type = std::uint32_t;
+};
+template <>
+struct unsigned_of<8> {
+  using type = std::uint64_t;
+};
+
+// Maps a key to an unsigned integer with the same ordering.
+template <typename K>
+typename unsigned_of<sizeof(K)>::type radix_key(K key) {
+  using U = typename unsigned_of<sizeof(K)>::type;
+  constexpr U sign = static_cast<U>(U{1} << (8 * sizeof(K) - 1));
+  U bits;
+  std::memcpy(&bits, &key, sizeof(K));
+  if constexpr (std::is_floating_point_v<K>) {
+    return (bits & sign) ? static_cast<U>(~bits) : static_cast<U>(bits ^ sign);
+  } else if constexpr (std::is_signed_v<K>) {
+    return static_cast<U>(bits ^ sign);
+  } else {
+    return bits;
+  }
+}
+
+struct identity {
+  template <typename T>
+  const T &operator()(const T &value) const {
+    return value;
+  }
+};
+
+}  // namespace detail
+
+template <typename T, typename Compare = std::less<>>
+void sort(T *first, T *last, Compare comp = Compare()) {
+  std::size_t n = static_cast<std::size_t>(last - first);
+  if (n < 2) return;
+  std::size_t depth = 0;
+  for (std::size_t i = n; i > 1; i >>= 1) depth += 2;
+  detail::introsort_loop(first, last, depth, comp);
+  detail::insertion_sort(first, last, comp);
+}
+
+// Bottom-up merge sort: insertion-sorted runs of 32 are merged back and
+// forth between the range and one buffer of n elements.
+template <typename T, typename Compare = std::less<>>
+void stable_sort(T *first, T *last, Compare comp = Compare()) {
+  constexpr std::size_t run = 32;
+  std::size_t n = static_cast<std::size_t>(last - first);
+  if (n <= run) {
+    detail::insertion_sort(first, last, comp);
+    return;
+  }
+  vector<T> buffer;
+  buffer.assign(std::make_move_iterator(first), std::make_move_iterator(last));
+  T *src = buffer.data();
+  T *dst = first;
+  for (std::size_t i = 0; i < n; i += run) {
+    detail::insertion_sort(src + i, src + std::min(n, i + run), comp);
+  }
+  for (std::size_t width = run; width < n; width *= 2) {
+    for (std::size_t lo = 0; lo < n; lo += 2 * width) {
+      std::size_t mid = std::min(lo + width, n);
+      std::size_t hi = std::min(lo + 2 * width, n);
+      detail::merge_move(src + lo, src + mid, src + mid, src + hi, dst + lo,
+                         comp);
+    }
+    std::swap(src, dst);
+  }
+  if (src != first) std::move(src, src + n, first);
+}
+
+// Stable LSD radix sort on the arithmetic key returned by key(element), one
+// byte per pass. Passes where every key has the same byte are skipped.
+// Floating point keys are ordered by value, with NaNs placed by bit pattern.
+template <typename T, typename KeyFn>
+void radix_sort(T *first, T *last, KeyFn key) {
+  using K = std::decay_t<decltype(key(*first))>;
+  static_assert(std::is_arithmetic_v<K> && !std::is_same_v<K, bool>,
+                "radix_sort needs an integer or floating point key");
+  constexpr std::size_t digits = sizeof(K);
+  std::size_t n = static_cast<std::size_t>(last - first);
+  if (n < 2) return;
+  std::size_t counts[digits][256] = {};
+  for (T *it = first; it != last; ++it) {
+    auto bits = detail::radix_key(static_cast<K>(key(*it)));
+    for (std::size_t d = 0; d < digits; ++d) {
+      ++counts[d][(bits >> (8 * d)) & 0xFF];
+    }
+  }
+  vector<T> buffer;
+  buffer.resize_for_overwrite(n);
+  T *src = first;
+  T *dst = buffer.data();
+  for (std::size_t d = 0; d < digits; ++d) {
+    auto first_bits = detail::radix_key(static_cast<K>(key(*src)));
+    if (counts[d][(first_bits >> (8 * d)) & 0xFF] == n) continue;
+    std::size_t offsets[256];
+    std::size_t sum = 0;
+    for (std::size_t b = 0; b < 256; ++b) {
+      offsets[b] = sum;
+      sum += counts[d][b];
+    }
+    for (T *it = src; it != src + n; ++it) {
+      auto bits = detail::radix_key(static_cast<K>(key(*it)));
+      dst[offsets[(bits >> (8 * d)) & 0xFF]++] = std::move(*it);
+    }
+    std::swap(src, dst);
+  }
+  if (src != first) std::move(src, src + n, first);
+}
+
+template <typename T>
+void radix_sort(T *first, T *last) {
+  radix_sort(first, last, detail::identity());
+}
+
+// Branchless binary searches: the loop runs exactly log2(n) times and the
+// comparison result feeds a conditional move instead of a jump.
+template <typename T, typename U, typename Compare = std::less<>>
+T *lower_bound(T *first, T *last, const U &value, Compare comp = Compare()) {
+  std::size_t n = static_cast<std::size_t>(last - first);
+  if (n == 0) return first;
+  while (n > 1) {
+    std::size_t half = n / 2;
+    first = comp(first[half], value) ? first + half : first;
+    n -= half;
+  }
+  return first + comp(*first, value);
+}
+
+template <typename T, typename U, typename Compare = std::less<>>
+T *upper_bound(T *first, T *last, const U &value, Compare comp = Compare()) {
+  std::size_t n = static_cast<std::size_t>(last - first);
+  if (n == 0) return first;
+  while (n > 1) {
+    std::size_t half = n / 2;
+    first = comp(value, first[half]) ? first : first + half;
+    n -= half;
+  }
+  return first + !comp(value, *first);
+}
+
+template <typename Container, typename Compare = std::less<>,
+          typename = require_contiguous<Container>>
+void sort(Container &&c, Compare comp = Compare()) {
+  s21::sort(c.data(), c.data() + c.size(), comp);
+}
+
+template <typename Container, typename Compare = std::less<>,
+          typename = require_contiguous<Container>>
+void stable_sort(Container &&c, Compare comp = Compare()) {
+  s21::stable_sort(c.data(), c.data() + c.size(), comp);
+}
+
+template <typename Container, typename = require_contiguous<Container>>
+void radix_sort(Container &&c) {
+  s21::radix_sort(c.data(), c.data() + c.size());
+}
+
+template <typename Container, typename KeyFn,
+          typename = require_contiguous<Container>>
+void radix_sort(Container &&c, KeyFn key) {
+  s21::radix_sort(c.data(), c.data() + c.size(), key);
+}
+
+template <typename Container, typename U, typename Compare = std::less<>,
+          typename = require_contiguous<Container>>
+auto lower_bound(Container &&c, const U &value, Compare comp = Compare())
+    -> decltype(c.begin()) {
+  auto first = c.data();
+  return c.begin() +
+         (s21::lower_bound(first, first + c.size(), value, comp) - first);
+}
+
+template <typename Container, typename U, typename Compare = std::less<>,
+          typename = require_contiguous<Container>>
+auto upper_bound(Container &&c, const U &value, Compare comp = Compare())
+    -> decltype(c.begin()) {
+  auto first = c.data();
+  return c.begin() +
+         (s21::upper_bound(first, first + c.size(), value, comp) - first);
+}
+
+}  // namespace s21
+
+#endif  // S21_ALGORITHM_H
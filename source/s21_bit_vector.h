@@ -0,0 +1,275 @@
+#ifndef S21_BIT_VECTOR_H
+#define S21_BIT_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+
+#include "s21_vector.h"
+#include "simd.h"
+
+namespace s21 {
+// Packed vector of bits stored in 64-bit words. Bits past size() in the
+// last word are always zero, so count(), the searches and the bulk
+// operations can work on whole words. The bulk operations (&=, |=, ^=,
+// and_not) run through the SIMD kernels in simd.h and need both vectors to
+// have the same size.
+class bit_vector {
+ public:
+  using value_type = bool;
+  using size_type = size_t;
+  using word_type = std::uint64_t;
+
+  static constexpr size_type npos = std::numeric_limits<size_type>::max();
+  static constexpr size_type word_bits = 64;
+
+  class reference {
+   public:
+    reference(word_type *word, word_type mask) : word_(word), mask_(mask) {}
+    reference(const reference &) = default;
+
+    operator bool() const { return (*word_ & mask_) != 0; }
+    reference &operator=(bool value) {
+      *word_ = value ? *word_ | mask_ : *word_ & ~mask_;
+      return *this;
+    }
+    reference &operator=(const reference &other) {
+      return *this = static_cast<bool>(other);
+    }
+    void flip() { *word_ ^= mask_; }
+
+   private:
+    word_type *word_;
+    word_type mask_;
+  };
+
+ private:
+  vector<word_type> words_;
+  size_type size_;
+
+ public:
+  bit_vector() : words_(), size_(0) {}
+
+  explicit bit_vector(size_type n, bool value = false) : bit_vector() {
+    resize(n, value);
+  }
+
+  bit_vector(std::initializer_list<bool> const &items) : bit_vector() {
+    reserve(items.size());
+    for (bool item : items) push_back(item);
+  }
+
+  bool operator[](size_type pos) const { return test(pos); }
+
+  reference operator[](size_type pos) {
+    return reference(&words_[pos / word_bits], mask(pos));
+  }
+
+  bool at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of range");
+    }
+    return test(pos);
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of range");
+    }
+    return (*this)[pos];
+  }
+
+  bool test(size_type pos) const {
+    return (words_[pos / word_bits] & mask(pos)) != 0;
+  }
+
+  void set(size_type pos, bool value = true) { (*this)[pos] = value; }
+
+  void reset(size_type pos) { set(pos, false); }
+
+  void flip(size_type pos) { words_[pos / word_bits] ^= mask(pos); }
+
+  bool front() const { return test(0); }
+
+  bool back() const { return test(size_ - 1); }
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const { return words_.max_size(); }
+
+  size_type capacity() const { return words_.capacity() * word_bits; }
+
+  void reserve(size_type bits) {
+    if (bits > max_size()) {
+      throw std::out_of_range(
+          "Size can't be bigger than max size of bit_vector");
+    }
+    words_.reserve(words_for(bits));
+  }
+
+  void shrink_to_fit() { words_.shrink_to_fit(); }
+
+  void clear() {
+    words_.clear();
+    size_ = 0;
+  }
+
+  void resize(size_type count, bool value = false) {
+    if (count > max_size()) {
+      throw std::out_of_range(
+          "Size can't be bigger than max size of bit_vector");
+    }
+    if (count > size_ && value) {
+      if (size_ % word_bits != 0) {
+        words_[size_ / word_bits] |= ~word_type{0} << (size_ % word_bits);
+      }
+      words_.resize(words_for(count), ~word_type{0});
+    } else {
+      words_.resize(words_for(count), 0);
+    }
+    size_ = count;
+    clear_tail();
+  }
+
+  // Raw words, least significant bit first.
+  const word_type *words() const { return words_.data(); }
+
+  size_type word_count() const { return words_.size(); }
+
+  void push_back(bool value) {
+    if (size_ % word_bits == 0) words_.push_back(0);
+    if (value) words_[size_ / word_bits] |= mask(size_);
+    ++size_;
+  }
+
+  void pop_back() {
+    if (size_ > 0) {
+      --size_;
+      if (size_ % word_bits == 0) {
+        words_.pop_back();
+      } else {
+        words_[size_ / word_bits] &= ~mask(size_);
+      }
+    }
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args... values) {
+    reserve(size_ + sizeof...(values));
+    (push_back(static_cast<bool>(values)), ...);
+  }
+
+  void swap(bit_vector &other) noexcept {
+    words_.swap(other.words_);
+    std::swap(size_, other.size_);
+  }
+
+  // Number of set bits.
+  size_type count() const {
+    const word_type *first = words_.data();
+    return simd::popcount(first, first + words_.size());
+  }
+
+  bool any() const { return find_first() != npos; }
+
+  bool none() const { return !any(); }
+
+  bool all() const { return count() == size_; }
+
+  // Index of the first set bit, or npos.
+  size_type find_first() const { return scan(0); }
+
+  // Index of the first set bit after pos, or npos.
+  size_type find_next(size_type pos) const {
+    if (pos >= size_ || pos + 1 == size_) return npos;
+    ++pos;
+    size_type index = pos / word_bits;
+    word_type rest = words_[index] & (~word_type{0} << (pos % word_bits));
+    if (rest != 0) return index * word_bits + lowest_bit(rest);
+    return scan(index + 1);
+  }
+
+  bit_vector &operator&=(const bit_vector &other) {
+    return apply<simd::bit_op::and_op>(other);
+  }
+
+  bit_vector &operator|=(const bit_vector &other) {
+    return apply<simd::bit_op::or_op>(other);
+  }
+
+  bit_vector &operator^=(const bit_vector &other) {
+    return apply<simd::bit_op::xor_op>(other);
+  }
+
+  // Clears every bit that is set in other.
+  bit_vector &and_not(const bit_vector &other) {
+    return apply<simd::bit_op::and_not_op>(other);
+  }
+
+  bool operator==(const bit_vector &other) const {
+    if (size_ != other.size_) return false;
+    const word_type *a = words_.data();
+    return simd::equal(a, a + words_.size(), other.words_.data());
+  }
+
+  bool operator!=(const bit_vector &other) const { return !(*this == other); }
+
+ private:
+  static size_type words_for(size_type bits) {
+    return (bits + word_bits - 1) / word_bits;
+  }
+
+  static word_type mask(size_type pos) {
+    return word_type{1} << (pos % word_bits);
+  }
+
+  static size_type lowest_bit(word_type word) {
+    return static_cast<size_type>(__builtin_ctzll(word));
+  }
+
+  void clear_tail() {
+    if (size_ % word_bits != 0) {
+      words_[size_ / word_bits] &= ~(~word_type{0} << (size_ % word_bits));
+    }
+  }
+
+  size_type scan(size_type index) const {
+    for (; index < words_.size(); ++index) {
+      word_type word = words_[index];
+      if (word != 0) return index * word_bits + lowest_bit(word);
+    }
+    return npos;
+  }
+
+  template <simd::bit_op Op>
+  bit_vector &apply(const bit_vector &other) {
+    if (size_ != other.size_) {
+      throw std::length_error("bit_vector sizes differ");
+    }
+    simd::bitwise<Op>(words_.data(), other.words_.data(), words_.size());
+    return *this;
+  }
+};
+
+inline bit_vector operator&(bit_vector lhs, const bit_vector &rhs) {
+  lhs &= rhs;
+  return lhs;
+}
+
+inline bit_vector operator|(bit_vector lhs, const bit_vector &rhs) {
+  lhs |= rhs;
+  return lhs;
+}
+
+inline bit_vector operator^(bit_vector lhs, const bit_vector &rhs) {
+  lhs ^= rhs;
+  return lhs;
+}
+
+}  // namespace s21
+
+#endif  // S21_BIT_VECTOR_H
@@ -0,0 +1,363 @@
+#ifndef S21_CONCURRENT_VECTOR_H
+#define S21_CONCURRENT_VECTOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Grow-only vector that many threads may append to and read at once.
+// Elements live in segments of first_segment, 2 * first_segment, 4 * ...
+// elements that are never moved, so references stay valid until the vector
+// is cleared or destroyed. push_back / emplace_back / grow_by claim their
+// indices with one fetch_add and allocate a missing segment with a CAS.
+//
+// size() counts the published prefix: elements whose construction has
+// finished, along with everything before them. Reading any index below
+// size() is safe without locks. If a constructor throws, its slot is left
+// empty; the prefix moves past it, at() throws for it and iteration skips
+// it, but operator[] on it is undefined. clear(), the destructor and
+// iteration while elements are being added need external synchronization.
+template <typename T>
+class concurrent_vector {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  static constexpr size_type first_segment = 32;
+
+ private:
+  enum slot_state : unsigned char { pending, ready, failed };
+
+  static constexpr int first_bits = 5;
+  static_assert(size_type{1} << first_bits == first_segment);
+  static constexpr int max_segments = 64 - first_bits;
+
+  std::atomic<T *> segments_[max_segments];
+  std::atomic<size_type> claimed_;
+  std::atomic<size_type> published_;
+
+ public:
+  template <bool Const>
+  class basic_iterator {
+    using owner = std::conditional_t<Const, const concurrent_vector,
+                                     concurrent_vector>;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+
+    basic_iterator() : owner_(nullptr), index_(0), end_(0) {}
+    basic_iterator(owner *v, size_type index, size_type end)
+        : owner_(v), index_(index), end_(end) {
+      skip_failed();
+    }
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    basic_iterator(const basic_iterator<false> &other)
+        : owner_(other.owner_), index_(other.index_), end_(other.end_) {}
+
+    reference operator*() const { return (*owner_)[index_]; }
+    pointer operator->() const { return &(*owner_)[index_]; }
+    basic_iterator &operator++() {
+      ++index_;
+      skip_failed();
+      return *this;
+    }
+    basic_iterator operator++(int) {
+      basic_iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+    bool operator==(const basic_iterator &other) const {
+      return index_ == other.index_;
+    }
+    bool operator!=(const basic_iterator &other) const {
+      return index_ != other.index_;
+    }
+    size_type index() const { return index_; }
+
+   private:
+    friend class basic_iterator<true>;
+
+    void skip_failed() {
+      while (index_ < end_ && owner_->state_of(index_) != ready) ++index_;
+    }
+
+    owner *owner_;
+    size_type index_;
+    size_type end_;
+  };
+
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  concurrent_vector() : segments_(), claimed_(0), published_(0) {
+    for (auto &s : segments_) s.store(nullptr, std::memory_order_relaxed);
+  }
+
+  concurrent_vector(std::initializer_list<T> const &items)
+      : concurrent_vector() {
+    for (const auto &item : items) push_back(item);
+  }
+
+  concurrent_vector(const concurrent_vector &) = delete;
+  concurrent_vector &operator=(const concurrent_vector &) = delete;
+
+  ~concurrent_vector() {
+    clear();
+    for (int s = 0; s < max_segments; ++s) {
+      T *data = segments_[s].load(std::memory_order_relaxed);
+      if (data) std::allocator<T>().deallocate(data, allocation_size(s));
+    }
+  }
+
+  reference operator[](size_type pos) { return slot(pos); }
+
+  const_reference operator[](size_type pos) const {
+    return slot(pos);
+  }
+
+  reference at(size_type pos) {
+    check(pos);
+    return slot(pos);
+  }
+
+  const_reference at(size_type pos) const {
+    check(pos);
+    return (*this)[pos];
+  }
+
+  iterator begin() { return iterator(this, 0, size()); }
+
+  const_iterator begin() const { return const_iterator(this, 0, size()); }
+
+  iterator end() {
+    size_type n = size();
+    return iterator(this, n, n);
+  }
+
+  const_iterator end() const {
+    size_type n = size();
+    return const_iterator(this, n, n);
+  }
+
+  const_iterator cbegin() const { return begin(); }
+
+  const_iterator cend() const { return end(); }
+
+  // Number of published elements, see the class comment.
+  size_type size() const { return published_.load(std::memory_order_acquire); }
+
+  bool empty() const { return size() == 0; }
+
+  size_type capacity() const {
+    size_type total = 0;
+    for (int s = 0; s < max_segments; ++s) {
+      if (!segments_[s].load(std::memory_order_acquire)) break;
+      total += segment_size(s);
+    }
+    return total;
+  }
+
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / (sizeof(T) + 1) / 2;
+  }
+
+  // Allocates the segments for the first n elements. Safe to call
+  // concurrently with appends.
+  void reserve(size_type n) {
+    if (n > max_size()) {
+      throw std::out_of_range(
+          "Size can't be bigger than max size of concurrent_vector");
+    }
+    if (n == 0) return;
+    for (int s = 0; s <= segment_of(n - 1); ++s) segment_at(s);
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    size_type index = claim(1);
+    construct(index, std::forward<Args>(args)...);
+    return slot(index);
+  }
+
+  reference push_back(const T &value) { return emplace_back(value); }
+
+  reference push_back(T &&value) { return emplace_back(std::move(value)); }
+
+  // Appends n value-initialized elements (copies of value) and returns the
+  // index of the first one.
+  size_type grow_by(size_type n) { return grow_with(n); }
+
+  size_type grow_by(size_type n, const T &value) { return grow_with(n, value); }
+
+  // Destroys the elements but keeps the segments. Not thread-safe.
+  void clear() noexcept {
+    size_type n = claimed_.load(std::memory_order_acquire);
+    for (size_type i = 0; i < n; ++i) {
+      if (!segment_for(i)) continue;
+      if (state_of(i) == ready) std::destroy_at(&slot(i));
+      state_ref(i).store(pending, std::memory_order_relaxed);
+    }
+    claimed_.store(0, std::memory_order_relaxed);
+    published_.store(0, std::memory_order_release);
+  }
+
+ private:
+  static int highest_bit(size_type x) {
+    return 63 - __builtin_clzll(static_cast<unsigned long long>(x));
+  }
+
+  static size_type segment_size(int s) { return first_segment << s; }
+
+  static int segment_of(size_type index) {
+    return highest_bit(index + first_segment) - first_bits;
+  }
+
+  static size_type offset_in_segment(size_type index) {
+    size_type j = index + first_segment;
+    return j - (size_type{1} << highest_bit(j));
+  }
+
+  // Elements plus enough extra T-sized units for the state bytes.
+  static size_type allocation_size(int s) {
+    size_type n = segment_size(s);
+    return n + (n + sizeof(T) - 1) / sizeof(T);
+  }
+
+  static std::atomic<unsigned char> *states(T *data, int s) {
+    return reinterpret_cast<std::atomic<unsigned char> *>(data +
+                                                          segment_size(s));
+  }
+
+  T *segment_at(int s) {
+    T *data = segments_[s].load(std::memory_order_acquire);
+    if (data) return data;
+    T *fresh = std::allocator<T>().allocate(allocation_size(s));
+    std::atomic<unsigned char> *state = states(fresh, s);
+    for (size_type i = 0; i < segment_size(s); ++i) {
+      new (state + i) std::atomic<unsigned char>(pending);
+    }
+    if (segments_[s].compare_exchange_strong(data, fresh,
+                                             std::memory_order_acq_rel)) {
+      return fresh;
+    }
+    std::allocator<T>().deallocate(fresh, allocation_size(s));
+    return data;
+  }
+
+  T &slot(size_type index) const {
+    int s = segment_of(index);
+    return segments_[s].load(std::memory_order_acquire)[offset_in_segment(
+        index)];
+  }
+
+  std::atomic<unsigned char> &state_ref(size_type index) const {
+    int s = segment_of(index);
+    return states(segments_[s].load(std::memory_order_acquire),
+                  s)[offset_in_segment(index)];
+  }
+
+  T *segment_for(size_type index) const {
+    return segments_[segment_of(index)].load(std::memory_order_acquire);
+  }
+
+  // A slot whose segment was never allocated counts as pending.
+  unsigned char state_of(size_type index) const {
+    if (!segment_for(index)) return pending;
+    return state_ref(index).load(std::memory_order_acquire);
+  }
+
+  void check(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("Index out of range");
+    }
+    if (state_of(pos) != ready) {
+      throw std::out_of_range("Element was not constructed");
+    }
+  }
+
+  // Reserves n slots. The size check and the segment allocation happen
+  // before the slots are taken, so a throw leaves nothing claimed that would
+  // have to be finished. A lost race only retries with the next range; the
+  // segments already allocated for it stay for later appends.
+  size_type claim(size_type n) {
+    size_type first = claimed_.load(std::memory_order_relaxed);
+    do {
+      if (n > max_size() || first > max_size() - n) {
+        throw std::out_of_range(
+            "Size can't be bigger than max size of concurrent_vector");
+      }
+      if (n != 0) {
+        for (int s = segment_of(first); s <= segment_of(first + n - 1); ++s) {
+          segment_at(s);
+        }
+      }
+    } while (!claimed_.compare_exchange_weak(first, first + n,
+                                             std::memory_order_relaxed));
+    return first;
+  }
+
+  // Every claimed slot has to be finished, or the published prefix would
+  // stop at it for good.
+  template <typename... Args>
+  size_type grow_with(size_type n, const Args &...args) {
+    size_type first = claim(n);
+    size_type i = first;
+    try {
+      for (; i < first + n; ++i) construct(i, args...);
+    } catch (...) {
+      for (++i; i < first + n; ++i) finish(i, failed);
+      throw;
+    }
+    return first;
+  }
+
+  template <typename... Args>
+  void construct(size_type index, Args &&...args) {
+    try {
+      ::new (static_cast<void *>(&slot(index)))
+          T(std::forward<Args>(args)...);
+    } catch (...) {
+      finish(index, failed);
+      throw;
+    }
+    finish(index, ready);
+  }
+
+  // Marks the slot done and moves the published prefix over every finished
+  // slot, so no thread waits for a slower writer. The state store and the
+  // prefix updates are sequentially consistent: of two writers finishing
+  // neighbouring slots, at least one sees the other's slot as done.
+  void finish(size_type index, slot_state state) {
+    state_ref(index).store(state);
+    size_type p = published_.load();
+    while (p < claimed_.load() && done(p)) {
+      if (published_.compare_exchange_weak(p, p + 1)) ++p;
+    }
+  }
+
+  // The segment of a slot that is claimed but not yet constructed may still
+  // be missing.
+  bool done(size_type index) const {
+    int s = segment_of(index);
+    T *data = segments_[s].load(std::memory_order_acquire);
+    return data && states(data, s)[offset_in_segment(index)].load() != pending;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_CONCURRENT_VECTOR_H
@@ -0,0 +1,241 @@
+#ifndef S21_COW_VECTOR_H
+#define S21_COW_VECTOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Copy-on-write vector. Copies share one reference-counted buffer, so
+// copying costs O(1); the first mutating call on a copy whose buffer is
+// shared duplicates the buffer. Const access never copies. Non-const
+// operator[], at, data, begin and end count as mutating, and (as with any
+// COW container) references obtained through them must not be used to
+// write after the vector has been copied again. The counter is atomic, so
+// copies may live in different threads.
+template <typename T>
+class cow_vector {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+ private:
+  struct buffer {
+    explicit buffer(vector<T> &&v) : refs(1), items(std::move(v)) {}
+    explicit buffer(const vector<T> &v) : refs(1), items(v) {}
+
+    std::atomic<size_type> refs;
+    vector<T> items;
+  };
+
+  buffer *buffer_;
+
+ public:
+  cow_vector() : buffer_(nullptr) {}
+
+  explicit cow_vector(size_type n) : cow_vector(vector<T>(n)) {}
+
+  cow_vector(std::initializer_list<T> const &items)
+      : cow_vector(vector<T>(items)) {}
+
+  explicit cow_vector(vector<T> items)
+      : buffer_(new buffer(std::move(items))) {}
+
+  cow_vector(const cow_vector &other) : buffer_(other.buffer_) {
+    if (buffer_) buffer_->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  cow_vector(cow_vector &&other) noexcept
+      : buffer_(std::exchange(other.buffer_, nullptr)) {}
+
+  ~cow_vector() { release(); }
+
+  cow_vector &operator=(const cow_vector &other) {
+    cow_vector(other).swap(*this);
+    return *this;
+  }
+
+  cow_vector &operator=(cow_vector &&other) noexcept {
+    cow_vector(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  // Number of cow_vectors sharing the buffer (0 when empty and unallocated).
+  size_type use_count() const {
+    return buffer_ ? buffer_->refs.load(std::memory_order_acquire) : 0;
+  }
+
+  bool unique() const { return use_count() <= 1; }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("Index out of range");
+    }
+    return data()[pos];
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size()) {
+      throw std::out_of_range("Index out of range");
+    }
+    return data()[pos];
+  }
+
+  const_reference operator[](size_type pos) const { return data()[pos]; }
+
+  reference operator[](size_type pos) { return data()[pos]; }
+
+  const_reference front() const { return data()[0]; }
+
+  const_reference back() const { return data()[size() - 1]; }
+
+  const T *data() const { return buffer_ ? buffer_->items.data() : nullptr; }
+
+  T *data() { return buffer_ ? own().data() : nullptr; }
+
+  const_iterator begin() const { return data(); }
+
+  const_iterator end() const { return data() + size(); }
+
+  iterator begin() { return data(); }
+
+  iterator end() { return data() + size(); }
+
+  const_iterator cbegin() const { return begin(); }
+
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size() == 0; }
+
+  size_type size() const { return buffer_ ? buffer_->items.size() : 0; }
+
+  size_type max_size() const { return vector<T>().max_size(); }
+
+  size_type capacity() const {
+    return buffer_ ? buffer_->items.capacity() : 0;
+  }
+
+  void reserve(size_type size) {
+    if (size > capacity() || !unique()) own().reserve(size);
+  }
+
+  void shrink_to_fit() {
+    if (buffer_ && unique()) buffer_->items.shrink_to_fit();
+  }
+
+  // Drops the reference to a shared buffer instead of copying it.
+  void clear() {
+    if (unique()) {
+      if (buffer_) buffer_->items.clear();
+    } else {
+      release();
+    }
+  }
+
+  void resize(size_type count) { own().resize(count); }
+
+  void resize(size_type count, const_reference value) {
+    T copy = value;
+    own().resize(count, copy);
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    size_type index = index_of(pos, true);
+    T copy = value;
+    vector<T> &items = own();
+    return items.insert(items.begin() + index, std::move(copy));
+  }
+
+  iterator insert(const_iterator pos, T &&value) {
+    size_type index = index_of(pos, true);
+    vector<T> &items = own();
+    return items.insert(items.begin() + index, std::move(value));
+  }
+
+  void erase(const_iterator pos) {
+    size_type index = index_of(pos, false);
+    vector<T> &items = own();
+    items.erase(items.begin() + index);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    if (first > last) {
+      throw std::out_of_range("Invalid iterator");
+    }
+    size_type index = index_of(first, true);
+    size_type count = static_cast<size_type>(last - first);
+    if (index + count > size()) {
+      throw std::out_of_range("Invalid iterator");
+    }
+    vector<T> &items = own();
+    return items.erase(items.begin() + index, items.begin() + index + count);
+  }
+
+  void push_back(const_reference value) {
+    T copy = value;
+    own().push_back(std::move(copy));
+  }
+
+  void push_back(T &&value) { own().push_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    return own().emplace_back(std::forward<Args>(args)...);
+  }
+
+  void pop_back() {
+    if (!empty()) own().pop_back();
+  }
+
+  void swap(cow_vector &other) noexcept {
+    std::swap(buffer_, other.buffer_);
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    own().insert_many_back(std::forward<Args>(args)...);
+  }
+
+ private:
+  void release() noexcept {
+    if (buffer_ &&
+        buffer_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete buffer_;
+    }
+    buffer_ = nullptr;
+  }
+
+  // Makes this the only owner of the buffer, copying it if it is shared,
+  // and returns the elements for modification.
+  vector<T> &own() {
+    if (!buffer_) {
+      buffer_ = new buffer(vector<T>());
+    } else if (buffer_->refs.load(std::memory_order_acquire) != 1) {
+      buffer *copy = new buffer(buffer_->items);
+      release();
+      buffer_ = copy;
+    }
+    return buffer_->items;
+  }
+
+  // Positions are taken before own() may replace the buffer.
+  size_type index_of(const_iterator pos, bool allow_end) const {
+    if (pos < cbegin() || pos > cend() || (!allow_end && pos == cend())) {
+      throw std::out_of_range(allow_end ? "Invalid pos of value"
+                                        : "Invalid iterator");
+    }
+    return static_cast<size_type>(pos - cbegin());
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_COW_VECTOR_H
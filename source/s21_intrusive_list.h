@@ -0,0 +1,295 @@
+#ifndef S21_INTRUSIVE_LIST_H
+#define S21_INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+class list_hook;
+
+template <typename T, list_hook T::*Member>
+class intrusive_list;
+
+// Links embedded in an object so that intrusive_list can chain it without
+// allocating. An object can be in as many lists as it has hooks, and in at
+// most one list per hook. The hook unlinks itself when the object is
+// destroyed, so a list never points at a dead object. Copying an object
+// does not copy its list membership.
+class list_hook {
+ public:
+  list_hook() : prev_(nullptr), next_(nullptr) {}
+  list_hook(const list_hook &) : list_hook() {}
+  list_hook &operator=(const list_hook &) { return *this; }
+  ~list_hook() { unlink(); }
+
+  bool is_linked() const { return next_ != nullptr; }
+
+  // Removes the object from whatever list it is in, in O(1).
+  void unlink() {
+    if (next_) {
+      prev_->next_ = next_;
+      next_->prev_ = prev_;
+      prev_ = next_ = nullptr;
+    }
+  }
+
+ private:
+  template <typename T, list_hook T::*Member>
+  friend class intrusive_list;
+
+  // Links this unlinked hook in front of pos.
+  void link_before(list_hook *pos) {
+    prev_ = pos->prev_;
+    next_ = pos;
+    prev_->next_ = this;
+    pos->prev_ = this;
+  }
+
+  list_hook *prev_;
+  list_hook *next_;
+};
+
+// Doubly linked list of objects that carry a list_hook member Member. The
+// list never owns, allocates or copies the objects; it only chains their
+// hooks around a sentinel, so insert, erase, unlink and splice are O(1).
+// T must be standard-layout, so that a hook sits at a fixed offset inside
+// its object. Because a hook may unlink itself at any time, the list does
+// not count its elements: empty() is O(1), size() walks the list.
+template <typename T, list_hook T::*Member>
+class intrusive_list {
+  static_assert(std::is_standard_layout_v<T>,
+                "intrusive_list needs a standard-layout T to find the object "
+                "that owns a hook");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  template <bool Const>
+  class basic_iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+
+    basic_iterator() : hook_(nullptr) {}
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    basic_iterator(const basic_iterator<false> &other)
+        : hook_(other.hook_) {}
+
+    reference operator*() const { return owner_of(hook_); }
+    pointer operator->() const { return &owner_of(hook_); }
+    basic_iterator &operator++() {
+      hook_ = hook_->next_;
+      return *this;
+    }
+    basic_iterator operator++(int) {
+      basic_iterator tmp = *this;
+      hook_ = hook_->next_;
+      return tmp;
+    }
+    basic_iterator &operator--() {
+      hook_ = hook_->prev_;
+      return *this;
+    }
+    basic_iterator operator--(int) {
+      basic_iterator tmp = *this;
+      hook_ = hook_->prev_;
+      return tmp;
+    }
+    bool operator==(const basic_iterator &other) const {
+      return hook_ == other.hook_;
+    }
+    bool operator!=(const basic_iterator &other) const {
+      return hook_ != other.hook_;
+    }
+
+   private:
+    friend class intrusive_list;
+    friend class basic_iterator<true>;
+
+    explicit basic_iterator(list_hook *hook) : hook_(hook) {}
+
+    list_hook *hook_;
+  };
+
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  intrusive_list() : root_() { root_.prev_ = root_.next_ = &root_; }
+
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list &operator=(const intrusive_list &) = delete;
+
+  intrusive_list(intrusive_list &&other) noexcept : intrusive_list() {
+    splice(end(), other);
+  }
+
+  intrusive_list &operator=(intrusive_list &&other) noexcept {
+    if (this != &other) {
+      clear();
+      splice(end(), other);
+    }
+    return *this;
+  }
+
+  // Unlinks every element; the objects themselves are left alone.
+  ~intrusive_list() {
+    clear();
+    root_.prev_ = root_.next_ = nullptr;
+  }
+
+  reference front() { return owner_of(root_.next_); }
+
+  const_reference front() const { return owner_of(root_.next_); }
+
+  reference back() { return owner_of(root_.prev_); }
+
+  const_reference back() const { return owner_of(root_.prev_); }
+
+  iterator begin() { return iterator(root_.next_); }
+
+  iterator end() { return iterator(&root_); }
+
+  const_iterator begin() const { return const_iterator(root_.next_); }
+
+  const_iterator end() const { return const_iterator(sentinel()); }
+
+  const_iterator cbegin() const { return begin(); }
+
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return root_.next_ == &root_; }
+
+  // O(n), see above.
+  size_type size() const {
+    size_type count = 0;
+    for (const list_hook *h = root_.next_; h != &root_; h = h->next_) ++count;
+    return count;
+  }
+
+  // Iterator to value, which must be in this list.
+  static iterator iterator_to(reference value) {
+    return iterator(&(value.*Member));
+  }
+
+  static const_iterator iterator_to(const_reference value) {
+    return const_iterator(const_cast<list_hook *>(&(value.*Member)));
+  }
+
+  // Links value in front of pos. Throws std::logic_error if value is
+  // already in a list through this hook.
+  iterator insert(const_iterator pos, reference value) {
+    list_hook &hook = value.*Member;
+    if (hook.is_linked()) {
+      throw std::logic_error("Object is already in a list");
+    }
+    hook.link_before(pos.hook_);
+    return iterator(&hook);
+  }
+
+  void push_back(reference value) { insert(end(), value); }
+
+  void push_front(reference value) { insert(begin(), value); }
+
+  // Unlinks the element at pos and returns the position after it.
+  iterator erase(const_iterator pos) {
+    list_hook *next = pos.hook_->next_;
+    pos.hook_->unlink();
+    return iterator(next);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    while (first != last) first = erase(first);
+    return iterator(last.hook_);
+  }
+
+  // Unlinks value, which must be in this list. Same as value.hook.unlink().
+  static void remove(reference value) { (value.*Member).unlink(); }
+
+  void pop_front() {
+    if (!empty()) erase(begin());
+  }
+
+  void pop_back() {
+    if (!empty()) erase(--end());
+  }
+
+  void clear() {
+    while (!empty()) root_.next_->unlink();
+  }
+
+  void swap(intrusive_list &other) noexcept {
+    intrusive_list tmp(std::move(other));
+    other.splice(other.end(), *this);
+    splice(end(), tmp);
+  }
+
+  // Moves all elements of other in front of pos.
+  void splice(const_iterator pos, intrusive_list &other) {
+    if (this == &other || other.empty()) return;
+    transfer(pos.hook_, other.root_.next_, &other.root_);
+  }
+
+  // Moves the element at it, which is in other, in front of pos.
+  void splice(const_iterator pos, intrusive_list &, const_iterator it) {
+    if (pos == it || pos.hook_ == it.hook_->next_) return;
+    transfer(pos.hook_, it.hook_, it.hook_->next_);
+  }
+
+  // Moves [first, last) of other in front of pos; pos must not be inside
+  // the range.
+  void splice(const_iterator pos, intrusive_list &, const_iterator first,
+              const_iterator last) {
+    if (first != last) transfer(pos.hook_, first.hook_, last.hook_);
+  }
+
+ private:
+  static T &owner_of(list_hook *hook) {
+    auto *bytes = reinterpret_cast<unsigned char *>(hook) - member_offset();
+    return *reinterpret_cast<T *>(bytes);
+  }
+
+  static const T &owner_of(const list_hook *hook) {
+    return owner_of(const_cast<list_hook *>(hook));
+  }
+
+  // Byte offset of Member inside T, like offsetof, which cannot take a
+  // member pointer. The address is formed once on zeroed static storage;
+  // nothing is read through it.
+  static std::ptrdiff_t member_offset() {
+    static const std::ptrdiff_t offset = [] {
+      alignas(T) static unsigned char probe[sizeof(T)];
+      T *object = reinterpret_cast<T *>(probe);
+      return reinterpret_cast<unsigned char *>(&(object->*Member)) - probe;
+    }();
+    return offset;
+  }
+
+  list_hook *sentinel() const { return const_cast<list_hook *>(&root_); }
+
+  // Relinks the chain [first, last) in front of pos.
+  static void transfer(list_hook *pos, list_hook *first, list_hook *last) {
+    list_hook *tail = last->prev_;
+    first->prev_->next_ = last;
+    last->prev_ = first->prev_;
+    first->prev_ = pos->prev_;
+    tail->next_ = pos;
+    pos->prev_->next_ = first;
+    pos->prev_ = tail;
+  }
+
+  list_hook root_;
+};
+
+}  // namespace s21
+
+#endif  // S21_INTRUSIVE_LIST_H
@@ -1,9 +1,14 @@
 #ifndef S21_LIST_H
 #define S21_LIST_H
 
+#include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <limits>
+#include <new>
+#include <utility>
+
+#include "node_pool.h"
 
 namespace s21 {
 
@@ -21,35 +26,55 @@ class list {
     Node* next;
     Node(const value_type& val, Node* p = nullptr, Node* n = nullptr)
         : data(val), prev(p), next(n) {}
+    Node(const Node&) = delete;
+    Node& operator=(const Node&) = delete;
   };
 
  private:
   Node* head_;
   Node* tail_;
   size_type size_;
+  // Nodes are carved from this slab pool, created on first use; its first
+  // chunk holds only a few nodes. It moves with the nodes on move and swap.
+  // Nodes spliced or merged in from another list are freed into this pool
+  // but keep their own chunk alive through its atomic reference count (see
+  // node_pool.h), so handing a list's nodes to a list owned by another
+  // thread is safe.
+  node_pool<Node>* pool_;
 
  public:
-  list() : head_(nullptr), tail_(nullptr), size_(0) {}
+  list() : head_(nullptr), tail_(nullptr), size_(0), pool_(nullptr) {}
   list(size_type n, const value_type& value = value_type()) : list() {
+    reserve(n);
     while (n--) push_back(value);
   }
   list(std::initializer_list<value_type> il) : list() {
+    reserve(il.size());
     for (const auto& value : il) push_back(value);
   }
   list(const list& other) : list() {
+    reserve(other.size_);
     for (Node* node = other.head_; node; node = node->next)
       push_back(node->data);
   }
   list(list&& other)
-      : head_(other.head_), tail_(other.tail_), size_(other.size_) {
+      : head_(other.head_),
+        tail_(other.tail_),
+        size_(other.size_),
+        pool_(other.pool_) {
     other.head_ = other.tail_ = nullptr;
     other.size_ = 0;
+    other.pool_ = nullptr;
+  }
+  ~list() {
+    clear();
+    delete pool_;
   }
-  ~list() { clear(); }
 
   list& operator=(const list& other) {
     if (this != &other) {
       clear();
+      reserve(other.size_);
       for (Node* node = other.head_; node; node = node->next)
         push_back(node->data);
     }
@@ -61,6 +86,7 @@ class list {
       head_ = other.head_;
       tail_ = other.tail_;
       size_ = other.size_;
+      std::swap(pool_, other.pool_);
       other.head_ = other.tail_ = nullptr;
       other.size_ = 0;
     }
@@ -71,6 +97,12 @@ class list {
     while (!empty()) pop_front();
   }
 
+  // Pre-allocates nodes so that the list can grow to count elements without
+  // allocating.
+  void reserve(size_type count) {
+    if (count > size_) get_pool().reserve(count - size_);
+  }
+
   const_reference front() const { return head_->data; }
   const_reference back() const { return tail_->data; }
 
@@ -147,7 +179,7 @@ class list {
   const_iterator cend() const { return const_iterator(nullptr); }
 
   void push_back(const_reference value) {
-    Node* node = new Node(value, tail_, nullptr);
+    Node* node = make_node(value, tail_, nullptr);
     if (tail_) tail_->next = node;
     tail_ = node;
     if (!head_) head_ = node;
@@ -162,13 +194,13 @@ class list {
         tail_->next = nullptr;
       else
         head_ = nullptr;
-      delete toDelete;
+      free_node(toDelete);
       --size_;
     }
   }
 
   void push_front(const_reference value) {
-    Node* node = new Node(value, nullptr, head_);
+    Node* node = make_node(value, nullptr, head_);
     if (head_) head_->prev = node; 
     head_ = node;
     if (!tail_) tail_ = node;
@@ -183,7 +215,7 @@ class list {
         head_->prev = nullptr;
       else
         tail_ = nullptr;
-      delete toDelete;
+      free_node(toDelete);
       --size_;
     }
   }
@@ -219,7 +251,7 @@ class list {
 
  private:
   void insert_node_before(Node* node, const_reference value) {
-    Node* newNode = new Node(value);
+    Node* newNode = make_node(value);
     if (node) {
       newNode->next = node;
       newNode->prev = node->prev;
@@ -237,6 +269,73 @@ class list {
     ++size_;
   }
 
+  node_pool<Node>& get_pool() {
+    if (!pool_) pool_ = new node_pool<Node>();
+    return *pool_;
+  }
+
+  Node* make_node(const_reference value, Node* prev = nullptr,
+                  Node* next = nullptr) {
+    Node* memory = get_pool().allocate();
+    try {
+      return ::new (static_cast<void*>(memory)) Node(value, prev, next);
+    } catch (...) {
+      pool_->deallocate(memory);
+      throw;
+    }
+  }
+
+  void free_node(Node* node) noexcept {
+    node->~Node();
+    pool_->deallocate(node);
+  }
+
+  // Merges the sorted null-terminated chain from into into, taking from
+  // into on ties, and leaves from empty. prev pointers are not maintained.
+  // If comp throws, into gets every node of both chains in unspecified
+  // order.
+  template <typename Compare>
+  static void merge_into(Node*& into, Node*& from, Compare& comp) {
+    Node* a = into;
+    Node* b = from;
+    Node** link = &into;
+    from = nullptr;
+    try {
+      while (a && b) {
+        if (comp(b->data, a->data)) {
+          *link = b;
+          b = b->next;
+        } else {
+          *link = a;
+          a = a->next;
+        }
+        link = &(*link)->next;
+      }
+    } catch (...) {
+      *link = concat(a, b);
+      throw;
+    }
+    *link = a ? a : b;
+  }
+
+  static Node* concat(Node* first, Node* second) {
+    if (!first) return second;
+    Node* last = first;
+    while (last->next) last = last->next;
+    last->next = second;
+    return first;
+  }
+
+  // Rebuilds prev pointers, head_ and tail_ from a null-terminated chain.
+  void relink(Node* first) {
+    head_ = first;
+    tail_ = nullptr;
+    for (Node* node = first; node; node = node->next) {
+      node->prev = tail_;
+      tail_ = node;
+    }
+  }
+
   // /\ BONUS PART /\ BONUS PART /\ BONUS PART /\ BONUS PART
  public:
   iterator insert(iterator pos, const_reference value) {
@@ -245,7 +344,7 @@ class list {
       return iterator(tail_);
     } else {
       Node* nodePos = pos.getNode();
-      Node* newNode = new Node(value, nodePos->prev, nodePos);
+      Node* newNode = make_node(value, nodePos->prev, nodePos);
       if (nodePos->prev)
         nodePos->prev->next = newNode;
       else
@@ -263,7 +362,7 @@ class list {
     if (nodePos->next) nodePos->next->prev = nodePos->prev;
     if (nodePos == head_) head_ = nodePos->next;
     if (nodePos == tail_) tail_ = nodePos->prev;
-    delete nodePos;
+    free_node(nodePos);
     --size_;
   }
 
@@ -271,6 +370,7 @@ class list {
     std::swap(head_, other.head_);
     std::swap(tail_, other.tail_);
     std::swap(size_, other.size_);
+    std::swap(pool_, other.pool_);
   }
 
   void reverse() {
@@ -298,39 +398,74 @@ class list {
     }
   }
 
-  void sort() {
-    if (head_ == nullptr || head_->next == nullptr) return;
-    bool swapped = true;
-    while (swapped) {
-      swapped = false;
-      for (Node* current = head_;
-           current != nullptr && current->next != nullptr;
-           current = current->next) {
-        if (current->data > current->next->data) {
-          std::swap(current->data, current->next->data);
-          swapped = true;
+  void sort() { sort(std::less<value_type>()); }
+
+  // Stable bottom-up merge sort that relinks nodes instead of moving
+  // values. bins[i] holds either nothing or a sorted run of 2^i nodes, and
+  // every new node is carried up through them like a binary counter, so
+  // only O(log n) run heads are kept. If comp throws, all nodes stay in the
+  // list in unspecified order.
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ < 2) return;
+    Node* bins[std::numeric_limits<size_type>::digits] = {};
+    size_type used = 0;
+    Node* rest = head_;
+    Node* carry = nullptr;
+    try {
+      while (rest) {
+        carry = rest;
+        rest = rest->next;
+        carry->next = nullptr;
+        size_type i = 0;
+        for (; bins[i]; ++i) {
+          merge_into(bins[i], carry, comp);
+          std::swap(carry, bins[i]);
         }
+        bins[i] = carry;
+        carry = nullptr;
+        if (i == used) ++used;
       }
+      for (size_type i = 0; i < used; ++i) {
+        if (bins[i]) {
+          merge_into(bins[i], carry, comp);
+          std::swap(carry, bins[i]);
+        }
+      }
+    } catch (...) {
+      for (size_type i = 0; i < used; ++i) carry = concat(carry, bins[i]);
+      relink(concat(carry, rest));
+      throw;
     }
+    relink(carry);
   }
 
-  void merge(list& other) {
-    iterator it = begin();
-    while (!other.empty() && it != end()) {
-      if (*it > other.front()) {
-        insert(it, other.front());
-        other.pop_front();
-      } else {
-        ++it;
-      }
-    }
-    while (!other.empty()) {
-      push_back(other.front());
-      other.pop_front();
+  void merge(list& other) { merge(other, std::less<value_type>()); }
+
+  // Relinks the nodes of other into this list in one linear pass; no
+  // values are copied and nothing is allocated. Equal elements of this list
+  // stay before those of other. If comp throws, every node ends up in this
+  // list in unspecified order.
+  template <typename Compare>
+  void merge(list& other, Compare comp) {
+    if (this == &other || other.empty()) return;
+    get_pool();
+    size_type total = size_ + other.size_;
+    Node* from = other.head_;
+    other.head_ = other.tail_ = nullptr;
+    other.size_ = 0;
+    size_ = total;
+    try {
+      merge_into(head_, from, comp);
+    } catch (...) {
+      relink(head_);
+      throw;
     }
+    relink(head_);
   }
 
   void splice(const_iterator pos, list& other) {
+    if (!other.empty()) get_pool();
     if (pos == cend()) {
       if (!other.empty()) {
         if (tail_) {
@@ -0,0 +1,405 @@
+#ifndef S21_MMAP_VECTOR_H
+#define S21_MMAP_VECTOR_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include "growth_policy.h"
+
+namespace s21 {
+
+// Identifies the element type stored in an mmap_vector file. The default
+// hashes the mangled type name, which is stable for a given ABI; specialize
+// it to keep files readable after renaming a type.
+template <typename T>
+struct mmap_type_tag {
+  static std::uint64_t value() {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const char *c = typeid(T).name(); *c != '\0'; ++c) {
+      hash = (hash ^ static_cast<unsigned char>(*c)) * 1099511628211ULL;
+    }
+    return hash;
+  }
+};
+
+enum class mmap_mode { read_write, read_only };
+
+// vector whose elements live in a file mapped with MAP_SHARED. The file
+// starts with a header holding the size, capacity and type tag, so opening
+// it again maps the stored elements back without reading or parsing them.
+// Growing extends the file with ftruncate and maps it again, which (as with
+// vector) invalidates pointers and iterators. In read_only mode every
+// modifying call throws std::logic_error; writing through a reference or
+// pointer obtained from such a vector faults.
+template <typename T, typename GrowthPolicy = doubling_growth>
+class mmap_vector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "mmap_vector needs a trivially copyable type");
+  static_assert(alignof(T) <= 64, "mmap_vector elements are 64 byte aligned");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+ private:
+  struct header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t value_size;
+    std::uint64_t type_tag;
+    std::uint64_t size;
+    std::uint64_t capacity;
+  };
+
+  static constexpr std::size_t data_offset = 64;
+  static constexpr char kMagic[8] = {'S', '2', '1', 'V', 'E', 'C', '\0', '\0'};
+  static constexpr std::uint32_t kVersion = 1;
+
+  std::string path_;
+  mmap_mode mode_;
+  int fd_;
+  void *map_;
+  std::size_t map_length_;
+
+ public:
+  // Opens path, creating an empty vector file when it does not exist and
+  // mode is read_write.
+  explicit mmap_vector(std::string path, mmap_mode mode = mmap_mode::read_write)
+      : path_(std::move(path)), mode_(mode), fd_(-1), map_(nullptr),
+        map_length_(0) {
+    bool writable = mode_ == mmap_mode::read_write;
+    fd_ = ::open(path_.c_str(), writable ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+    if (fd_ < 0) fail("open");
+    try {
+      struct stat st;
+      if (::fstat(fd_, &st) != 0) fail("fstat");
+      if (st.st_size == 0 && writable) {
+        create();
+      } else {
+        open_existing(static_cast<std::size_t>(st.st_size));
+      }
+    } catch (...) {
+      close();
+      throw;
+    }
+  }
+
+  mmap_vector(const mmap_vector &) = delete;
+  mmap_vector &operator=(const mmap_vector &) = delete;
+
+  mmap_vector(mmap_vector &&other) noexcept
+      : path_(std::move(other.path_)), mode_(other.mode_), fd_(other.fd_),
+        map_(other.map_), map_length_(other.map_length_) {
+    other.fd_ = -1;
+    other.map_ = nullptr;
+    other.map_length_ = 0;
+  }
+
+  mmap_vector &operator=(mmap_vector &&other) noexcept {
+    if (this != &other) {
+      close();
+      path_ = std::move(other.path_);
+      mode_ = other.mode_;
+      std::swap(fd_, other.fd_);
+      std::swap(map_, other.map_);
+      std::swap(map_length_, other.map_length_);
+    }
+    return *this;
+  }
+
+  ~mmap_vector() { close(); }
+
+  const std::string &path() const { return path_; }
+
+  bool read_only() const { return mode_ == mmap_mode::read_only; }
+
+  reference at(size_type pos) {
+    if (pos >= size()) {
+      throw std::out_of_range("Index out of range");
+    }
+    return data()[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("Index out of range");
+    }
+    return data()[pos];
+  }
+
+  reference operator[](size_type pos) { return data()[pos]; }
+
+  const_reference operator[](size_type pos) const { return data()[pos]; }
+
+  const_reference front() const { return data()[0]; }
+
+  const_reference back() const { return data()[size() - 1]; }
+
+  T *data() { return elements(); }
+
+  const T *data() const { return elements(); }
+
+  iterator begin() { return data(); }
+
+  const_iterator begin() const { return data(); }
+
+  iterator end() { return data() + size(); }
+
+  const_iterator end() const { return data() + size(); }
+
+  const_iterator cbegin() const { return data(); }
+
+  const_iterator cend() const { return data() + size(); }
+
+  bool empty() const { return size() == 0; }
+
+  size_type size() const {
+    return map_ ? static_cast<size_type>(head()->size) : 0;
+  }
+
+  size_type max_size() const {
+    return (static_cast<std::size_t>(std::numeric_limits<off_t>::max()) -
+            data_offset) /
+           sizeof(T);
+  }
+
+  size_type capacity() const {
+    return map_ ? static_cast<size_type>(head()->capacity) : 0;
+  }
+
+  void reserve(size_type size) {
+    writable();
+    if (size > max_size()) {
+      throw std::out_of_range(
+          "Size can't be bigger than max size of mmap_vector");
+    }
+    if (size > capacity()) remap(size);
+  }
+
+  void shrink_to_fit() {
+    writable();
+    if (capacity() > size()) remap(size());
+  }
+
+  void clear() {
+    writable();
+    if (map_) head()->size = 0;  // a moved-from vector has no mapping
+  }
+
+  void resize(size_type count) { resize(count, T()); }
+
+  void resize(size_type count, const_reference value) {
+    writable();
+    T copy = value;
+    if (count > size()) {
+      grow_to_fit(count);
+      std::fill(data() + size(), data() + count, copy);
+    }
+    head()->size = count;
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    writable();
+    if (pos < cbegin() || pos > cend()) {
+      throw std::out_of_range("Invalid pos of value");
+    }
+    size_type index = static_cast<size_type>(pos - cbegin());
+    T copy = value;
+    grow_to_fit(size() + 1);
+    std::memmove(static_cast<void *>(data() + index + 1),
+                 static_cast<const void *>(data() + index),
+                 (size() - index) * sizeof(T));
+    data()[index] = copy;
+    ++head()->size;
+    return begin() + index;
+  }
+
+  void erase(const_iterator pos) {
+    if (pos < cbegin() || pos >= cend()) {
+      throw std::out_of_range("Invalid iterator");
+    }
+    erase(pos, pos + 1);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    writable();
+    if (first < cbegin() || first > last || last > cend()) {
+      throw std::out_of_range("Invalid iterator");
+    }
+    size_type index = static_cast<size_type>(first - cbegin());
+    size_type count = static_cast<size_type>(last - first);
+    std::memmove(static_cast<void *>(data() + index),
+                 static_cast<const void *>(data() + index + count),
+                 (size() - index - count) * sizeof(T));
+    head()->size -= count;
+    return begin() + index;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    writable();
+    T value(std::forward<Args>(args)...);
+    grow_to_fit(size() + 1);
+    T *slot = data() + size();
+    *slot = value;
+    ++head()->size;
+    return *slot;
+  }
+
+  void pop_back() {
+    writable();
+    if (size() > 0) --head()->size;
+  }
+
+  void swap(mmap_vector &other) noexcept {
+    std::swap(path_, other.path_);
+    std::swap(mode_, other.mode_);
+    std::swap(fd_, other.fd_);
+    std::swap(map_, other.map_);
+    std::swap(map_length_, other.map_length_);
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    writable();
+    if constexpr (sizeof...(args) > 0) {
+      T values[] = {T(std::forward<Args>(args))...};
+      grow_to_fit(size() + sizeof...(args));
+      std::memcpy(static_cast<void *>(data() + size()),
+                  static_cast<const void *>(values), sizeof(values));
+      head()->size += sizeof...(args);
+    }
+  }
+
+  // Flushes the mapped pages to the file and waits for the write to finish.
+  void sync() {
+    if (map_ && !read_only() && ::msync(map_, map_length_, MS_SYNC) != 0) {
+      fail("msync");
+    }
+  }
+
+ private:
+  [[noreturn]] void fail(const char *what) const {
+    throw std::system_error(errno, std::generic_category(),
+                            "mmap_vector " + path_ + ": " + what);
+  }
+
+  void writable() const {
+    if (read_only()) {
+      throw std::logic_error("mmap_vector " + path_ + " is read-only");
+    }
+  }
+
+  header *head() const { return static_cast<header *>(map_); }
+
+  T *elements() const {
+    return map_ ? reinterpret_cast<T *>(static_cast<char *>(map_) +
+                                        data_offset)
+                : nullptr;
+  }
+
+  static std::size_t file_length(size_type capacity) {
+    return data_offset + capacity * sizeof(T);
+  }
+
+  void map(std::size_t length) {
+    int prot = read_only() ? PROT_READ : PROT_READ | PROT_WRITE;
+    void *map = ::mmap(nullptr, length, prot, MAP_SHARED, fd_, 0);
+    if (map == MAP_FAILED) fail("mmap");
+    map_ = map;
+    map_length_ = length;
+  }
+
+  void create() {
+    if (::ftruncate(fd_, static_cast<off_t>(file_length(0))) != 0) {
+      fail("ftruncate");
+    }
+    map(file_length(0));
+    header *h = head();
+    std::memcpy(h->magic, kMagic, sizeof(kMagic));
+    h->version = kVersion;
+    h->value_size = sizeof(T);
+    h->type_tag = mmap_type_tag<T>::value();
+    h->size = 0;
+    h->capacity = 0;
+  }
+
+  void open_existing(std::size_t length) {
+    if (length < data_offset) {
+      throw std::runtime_error("mmap_vector " + path_ +
+                               ": file is too short for a header");
+    }
+    map(length);
+    const header *h = head();
+    if (std::memcmp(h->magic, kMagic, sizeof(kMagic)) != 0 ||
+        h->version != kVersion) {
+      throw std::runtime_error("mmap_vector " + path_ +
+                               ": not an mmap_vector file");
+    }
+    if (h->value_size != sizeof(T) ||
+        h->type_tag != mmap_type_tag<T>::value()) {
+      throw std::runtime_error("mmap_vector " + path_ +
+                               ": stored element type does not match");
+    }
+    if (h->size > h->capacity || h->capacity > max_size() ||
+        file_length(static_cast<size_type>(h->capacity)) > length) {
+      throw std::runtime_error("mmap_vector " + path_ +
+                               ": header does not match the file size");
+    }
+  }
+
+  // Resizes the file to hold new_capacity elements and maps it again.
+  void remap(size_type new_capacity) {
+    std::size_t length = file_length(new_capacity);
+    if (::ftruncate(fd_, static_cast<off_t>(length)) != 0) fail("ftruncate");
+    void *old = map_;
+    std::size_t old_length = map_length_;
+    map(length);
+    ::munmap(old, old_length);
+    head()->capacity = new_capacity;
+  }
+
+  void grow_to_fit(size_type required) {
+    if (required <= capacity()) return;
+    if (required > max_size()) {
+      throw std::out_of_range(
+          "Size can't be bigger than max size of mmap_vector");
+    }
+    size_type next =
+        GrowthPolicy::next_capacity(capacity(), required, sizeof(T));
+    remap(std::max(required, std::min(next, max_size())));
+  }
+
+  void close() noexcept {
+    if (map_) ::munmap(map_, map_length_);
+    if (fd_ >= 0) ::close(fd_);
+    map_ = nullptr;
+    map_length_ = 0;
+    fd_ = -1;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_MMAP_VECTOR_H
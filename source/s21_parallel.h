@@ -0,0 +1,245 @@
+#ifndef S21_PARALLEL_H
+#define S21_PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#include "s21_algorithm.h"
+#include "s21_vector.h"
+#include "thread_pool.h"
+
+namespace s21 {
+// Parallel versions of the s21 algorithms for contiguous ranges. The work
+// is split into chunks that run on thread_pool::instance(); ranges shorter
+// than sequential_threshold run on the calling thread. reduce and
+// inclusive_scan regroup the operations, so op must be associative.
+namespace parallel {
+
+constexpr std::size_t sequential_threshold = 1 << 15;
+
+namespace detail {
+
+inline std::size_t chunk_count(std::size_t n) {
+  if (n < sequential_threshold) return 1;
+  std::size_t grain = sequential_threshold / 4;
+  return std::min(4 * thread_pool::instance().size(), (n + grain - 1) / grain);
+}
+
+// Calls body(begin, end) for every chunk of [0, n), the first one on the
+// calling thread.
+template <typename Body>
+void for_chunks(std::size_t n, Body body) {
+  std::size_t chunks = chunk_count(n);
+  if (chunks < 2) {
+    body(std::size_t{0}, n);
+    return;
+  }
+  task_group group;
+  for (std::size_t i = 1; i < chunks; ++i) {
+    group.run([&body, n, chunks, i] {
+      body(n * i / chunks, n * (i + 1) / chunks);
+    });
+  }
+  body(std::size_t{0}, n / chunks);
+  group.wait();
+}
+
+// Stable merge of two sorted ranges into out. The longer range is split in
+// half and its middle element is located in the other one, so both halves
+// can be merged independently.
+template <typename T, typename Compare>
+void merge(T *first1, T *last1, T *first2, T *last2, T *out, Compare &comp) {
+  std::size_t n1 = static_cast<std::size_t>(last1 - first1);
+  std::size_t n2 = static_cast<std::size_t>(last2 - first2);
+  if (n1 + n2 <= sequential_threshold) {
+    s21::detail::merge_move(first1, last1, first2, last2, out, comp);
+    return;
+  }
+  T *mid1 = first1;
+  T *mid2 = first2;
+  if (n1 >= n2) {
+    mid1 = first1 + n1 / 2;
+    mid2 = s21::lower_bound(first2, last2, *mid1, std::ref(comp));
+  } else {
+    mid2 = first2 + n2 / 2;
+    mid1 = s21::upper_bound(first1, last1, *mid2, std::ref(comp));
+  }
+  T *out_mid = out + (mid1 - first1) + (mid2 - first2);
+  task_group group;
+  group.run([=, &comp] { merge(first1, mid1, first2, mid2, out, comp); });
+  merge(mid1, last1, mid2, last2, out_mid, comp);
+  group.wait();
+}
+
+// Sorts [first, last) using [buffer, buffer + n) as scratch space.
+template <typename T, typename Compare>
+void merge_sort(T *first, T *last, T *buffer, Compare &comp) {
+  std::size_t n = static_cast<std::size_t>(last - first);
+  if (n <= sequential_threshold) {
+    s21::sort(first, last, std::ref(comp));
+    return;
+  }
+  T *mid = first + n / 2;
+  {
+    task_group group;
+    group.run([=, &comp] { merge_sort(first, mid, buffer, comp); });
+    merge_sort(mid, last, buffer + n / 2, comp);
+    group.wait();
+  }
+  merge(first, mid, mid, last, buffer, comp);
+  for_chunks(n, [=](std::size_t lo, std::size_t hi) {
+    std::move(buffer + lo, buffer + hi, first + lo);
+  });
+}
+
+}  // namespace detail
+
+template <typename T, typename F>
+void for_each(T *first, T *last, F f) {
+  detail::for_chunks(static_cast<std::size_t>(last - first),
+                     [=](std::size_t lo, std::size_t hi) {
+                       std::for_each(first + lo, first + hi, f);
+                     });
+}
+
+template <typename T, typename U, typename UnaryOp>
+U *transform(T *first, T *last, U *out, UnaryOp op) {
+  std::size_t n = static_cast<std::size_t>(last - first);
+  detail::for_chunks(n, [=](std::size_t lo, std::size_t hi) {
+    std::transform(first + lo, first + hi, out + lo, op);
+  });
+  return out + n;
+}
+
+// Each chunk is folded separately, then the partial results are combined
+// from left to right with init in front.
+template <typename T, typename U, typename BinaryOp = std::plus<>>
+U reduce(T *first, T *last, U init, BinaryOp op = BinaryOp()) {
+  std::size_t n = static_cast<std::size_t>(last - first);
+  std::size_t chunks = detail::chunk_count(n);
+  if (chunks < 2) return std::accumulate(first, last, std::move(init), op);
+  vector<U> partial(chunks);
+  task_group group;
+  for (std::size_t i = 0; i < chunks; ++i) {
+    group.run([=, &partial] {
+      T *lo = first + n * i / chunks;
+      T *hi = first + n * (i + 1) / chunks;
+      U acc = *lo;
+      for (++lo; lo != hi; ++lo) acc = op(std::move(acc), *lo);
+      partial[i] = std::move(acc);
+    });
+  }
+  group.wait();
+  for (std::size_t i = 0; i < chunks; ++i) {
+    init = op(std::move(init), std::move(partial[i]));
+  }
+  return init;
+}
+
+// Two passes: every chunk is scanned on its own, then the running total of
+// the chunks before it is folded into each of its elements.
+template <typename T, typename U, typename BinaryOp = std::plus<>>
+U *inclusive_scan(T *first, T *last, U *out, BinaryOp op = BinaryOp()) {
+  std::size_t n = static_cast<std::size_t>(last - first);
+  std::size_t chunks = detail::chunk_count(n);
+  if (chunks < 2) return std::partial_sum(first, last, out, op);
+  auto bounds = [n, chunks](std::size_t i) { return n * i / chunks; };
+  {
+    task_group group;
+    for (std::size_t i = 0; i < chunks; ++i) {
+      group.run([=] {
+        std::partial_sum(first + bounds(i), first + bounds(i + 1),
+                         out + bounds(i), op);
+      });
+    }
+    group.wait();
+  }
+  vector<U> offsets(chunks);
+  offsets[1] = out[bounds(1) - 1];
+  for (std::size_t i = 2; i < chunks; ++i) {
+    offsets[i] = op(offsets[i - 1], out[bounds(i) - 1]);
+  }
+  task_group group;
+  for (std::size_t i = 1; i < chunks; ++i) {
+    group.run([=, &offsets] {
+      for (U *it = out + bounds(i); it != out + bounds(i + 1); ++it) {
+        *it = op(offsets[i], *it);
+      }
+    });
+  }
+  group.wait();
+  return out + n;
+}
+
+// Merge sort: halves are sorted in parallel down to sequential_threshold
+// elements, then joined by a divide-and-conquer merge through a buffer of n
+// elements. Equal elements may be reordered, as with s21::sort.
+template <typename T, typename Compare = std::less<>>
+void sort(T *first, T *last, Compare comp = Compare()) {
+  std::size_t n = static_cast<std::size_t>(last - first);
+  if (n <= sequential_threshold) {
+    s21::sort(first, last, comp);
+    return;
+  }
+  vector<T> buffer;
+  if constexpr (std::is_trivially_default_constructible_v<T>) {
+    buffer.resize_for_overwrite(n);
+    detail::merge_sort(first, last, buffer.data(), comp);
+  } else {
+    // The scratch space has to hold live objects, so the elements are
+    // sorted inside the buffer and the range serves as scratch instead.
+    buffer.assign(std::make_move_iterator(first),
+                  std::make_move_iterator(last));
+    T *sorted = buffer.data();
+    detail::merge_sort(sorted, sorted + n, first, comp);
+    detail::for_chunks(n, [=](std::size_t lo, std::size_t hi) {
+      std::move(sorted + lo, sorted + hi, first + lo);
+    });
+  }
+}
+
+template <typename Container, typename F,
+          typename = require_contiguous<Container>>
+void for_each(Container &&c, F f) {
+  parallel::for_each(c.data(), c.data() + c.size(), f);
+}
+
+// out must already hold at least c.size() elements.
+template <typename Container, typename OutContainer, typename UnaryOp,
+          typename = require_contiguous<Container>,
+          typename = require_contiguous<OutContainer>>
+void transform(Container &&c, OutContainer &&out, UnaryOp op) {
+  parallel::transform(c.data(), c.data() + c.size(), out.data(), op);
+}
+
+template <typename Container, typename U, typename BinaryOp = std::plus<>,
+          typename = require_contiguous<Container>>
+U reduce(Container &&c, U init, BinaryOp op = BinaryOp()) {
+  return parallel::reduce(c.data(), c.data() + c.size(), std::move(init), op);
+}
+
+// out must already hold at least c.size() elements.
+template <typename Container, typename OutContainer,
+          typename BinaryOp = std::plus<>,
+          typename = require_contiguous<Container>,
+          typename = require_contiguous<OutContainer>>
+void inclusive_scan(Container &&c, OutContainer &&out,
+                    BinaryOp op = BinaryOp()) {
+  parallel::inclusive_scan(c.data(), c.data() + c.size(), out.data(), op);
+}
+
+template <typename Container, typename Compare = std::less<>,
+          typename = require_contiguous<Container>>
+void sort(Container &&c, Compare comp = Compare()) {
+  parallel::sort(c.data(), c.data() + c.size(), comp);
+}
+
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // S21_PARALLEL_H
@@ -0,0 +1,222 @@
+#ifndef S21_SLOT_MAP_H
+#define S21_SLOT_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Unordered container addressed by stable handles. Each handle packs a
+// 32-bit slot index and a 32-bit generation into one 64-bit value; erasing
+// an element bumps its slot's generation, so old handles to it stop
+// resolving instead of aliasing whatever reuses the slot. Live elements are
+// kept densely packed in a vector (erase moves the last element into the
+// hole), so iteration is a linear scan, but the order of elements is not
+// preserved. Free slots are recycled through an intrusive free list. Insert,
+// erase and lookup are O(1).
+template <typename T>
+class slot_map {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  class handle {
+   public:
+    handle() : id_(std::numeric_limits<std::uint64_t>::max()) {}
+    handle(std::uint32_t index, std::uint32_t generation)
+        : id_(std::uint64_t{generation} << 32 | index) {}
+
+    // Raw 64-bit value, e.g. for storing the handle outside of C++ code.
+    std::uint64_t id() const { return id_; }
+    static handle from_id(std::uint64_t id) {
+      handle h;
+      h.id_ = id;
+      return h;
+    }
+
+    std::uint32_t index() const { return static_cast<std::uint32_t>(id_); }
+    std::uint32_t generation() const {
+      return static_cast<std::uint32_t>(id_ >> 32);
+    }
+
+    bool operator==(const handle &other) const { return id_ == other.id_; }
+    bool operator!=(const handle &other) const { return id_ != other.id_; }
+
+   private:
+    std::uint64_t id_;
+  };
+
+ private:
+  static constexpr std::uint32_t npos =
+      std::numeric_limits<std::uint32_t>::max();
+
+  // index is the element's position in values_ while the slot is live and
+  // the next free slot while it is free.
+  struct slot {
+    std::uint32_t index;
+    std::uint32_t generation;
+  };
+
+  vector<T> values_;
+  vector<std::uint32_t> owners_;  // slot index of each element in values_
+  vector<slot> slots_;
+  std::uint32_t free_head_;
+
+ public:
+  slot_map() : values_(), owners_(), slots_(), free_head_(npos) {}
+
+  bool empty() const { return values_.empty(); }
+
+  size_type size() const { return values_.size(); }
+
+  size_type max_size() const { return npos; }
+
+  size_type capacity() const { return values_.capacity(); }
+
+  void reserve(size_type size) {
+    values_.reserve(size);
+    owners_.reserve(size);
+    slots_.reserve(size);
+  }
+
+  handle insert(const_reference value) { return emplace(value); }
+
+  handle insert(T &&value) { return emplace(std::move(value)); }
+
+  template <typename... Args>
+  handle emplace(Args &&...args) {
+    if (free_head_ == npos && slots_.size() >= max_size()) {
+      throw std::length_error("slot_map is full");
+    }
+    owners_.push_back(npos);
+    std::uint32_t index = npos;
+    try {
+      values_.emplace_back(std::forward<Args>(args)...);
+      try {
+        index = acquire_slot();
+      } catch (...) {
+        values_.pop_back();
+        throw;
+      }
+    } catch (...) {
+      owners_.pop_back();
+      throw;
+    }
+    owners_[owners_.size() - 1] = index;
+    slots_[index].index = static_cast<std::uint32_t>(values_.size() - 1);
+    return handle(index, slots_[index].generation);
+  }
+
+  // Returns false if h is stale or was never issued by this map.
+  bool erase(handle h) {
+    if (!contains(h)) return false;
+    std::uint32_t pos = slots_[h.index()].index;
+    std::uint32_t last = static_cast<std::uint32_t>(values_.size() - 1);
+    if (pos != last) {
+      values_[pos] = std::move(values_[last]);
+      owners_[pos] = owners_[last];
+      slots_[owners_[pos]].index = pos;
+    }
+    values_.pop_back();
+    owners_.pop_back();
+    release_slot(h.index());
+    return true;
+  }
+
+  void clear() noexcept {
+    for (size_type i = 0; i < owners_.size(); ++i) release_slot(owners_[i]);
+    values_.clear();
+    owners_.clear();
+  }
+
+  bool contains(handle h) const {
+    if (h.index() >= slots_.size()) return false;
+    const slot &s = slots_[h.index()];
+    return s.generation == h.generation() && s.index < owners_.size() &&
+           owners_[s.index] == h.index();
+  }
+
+  // nullptr if h is stale.
+  T *find(handle h) { return contains(h) ? &values_[slot_of(h)] : nullptr; }
+
+  const T *find(handle h) const {
+    return contains(h) ? &values_[slot_of(h)] : nullptr;
+  }
+
+  reference at(handle h) {
+    if (!contains(h)) {
+      throw std::out_of_range("Invalid handle");
+    }
+    return values_[slot_of(h)];
+  }
+
+  const_reference at(handle h) const {
+    if (!contains(h)) {
+      throw std::out_of_range("Invalid handle");
+    }
+    return values_[slot_of(h)];
+  }
+
+  reference operator[](handle h) { return values_[slot_of(h)]; }
+
+  const_reference operator[](handle h) const { return values_[slot_of(h)]; }
+
+  // Handle of the element at position pos of the dense storage.
+  handle handle_at(size_type pos) const {
+    std::uint32_t index = owners_[pos];
+    return handle(index, slots_[index].generation);
+  }
+
+  T *data() { return values_.data(); }
+
+  const T *data() const { return values_.data(); }
+
+  iterator begin() { return values_.data(); }
+
+  iterator end() { return values_.data() + values_.size(); }
+
+  const_iterator begin() const { return values_.data(); }
+
+  const_iterator end() const { return values_.data() + values_.size(); }
+
+  void swap(slot_map &other) noexcept {
+    values_.swap(other.values_);
+    owners_.swap(other.owners_);
+    slots_.swap(other.slots_);
+    std::swap(free_head_, other.free_head_);
+  }
+
+ private:
+  size_type slot_of(handle h) const { return slots_[h.index()].index; }
+
+  std::uint32_t acquire_slot() {
+    if (free_head_ == npos) {
+      slots_.push_back(slot{0, 0});
+      return static_cast<std::uint32_t>(slots_.size() - 1);
+    }
+    std::uint32_t index = free_head_;
+    free_head_ = slots_[index].index;
+    return index;
+  }
+
+  // A slot whose generation would wrap around is retired for good, so a
+  // handle can never resolve to a later element in the same slot.
+  void release_slot(std::uint32_t index) noexcept {
+    slot &s = slots_[index];
+    if (++s.generation == npos) return;
+    s.index = free_head_;
+    free_head_ = index;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_SLOT_MAP_H
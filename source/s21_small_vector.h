@@ -0,0 +1,386 @@
+#ifndef S21_SMALL_VECTOR_H
+#define S21_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+#include "growth_policy.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// vector with room for N elements inside the object itself. The heap is
+// only used once the size grows past N.
+template <typename T, std::size_t N, typename GrowthPolicy = doubling_growth>
+class small_vector {
+  static_assert(N > 0, "small_vector needs at least one inline element");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+ private:
+  T *data_;
+  size_type capacity_;
+  size_type size_;
+  std::allocator<T> allocator_;
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+
+ public:
+  small_vector()
+      : data_(inline_data()), capacity_(N), size_(0), allocator_() {}
+
+  explicit small_vector(size_type n) : small_vector() {
+    reserve(n);
+    for (; size_ < n; ++size_) allocator_.construct(data_ + size_);
+  }
+
+  small_vector(std::initializer_list<T> const &items) : small_vector() {
+    reserve(items.size());
+    for (const auto &item : items) emplace_back(item);
+  }
+
+  small_vector(const small_vector &other) : small_vector() {
+    reserve(other.size_);
+    for (const auto &item : other) emplace_back(item);
+  }
+
+  small_vector(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>)
+      : small_vector() {
+    take(other);
+  }
+
+  ~small_vector() {
+    clear();
+    release();
+  }
+
+  small_vector &operator=(const small_vector &other) {
+    if (this != &other) {
+      clear();
+      reserve(other.size_);
+      for (const auto &item : other) emplace_back(item);
+    }
+    return *this;
+  }
+
+  small_vector &operator=(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other) {
+      clear();
+      release();
+      take(other);
+    }
+    return *this;
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of range");
+    }
+    return data_[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of range");
+    }
+    return data_[pos];
+  }
+
+  reference operator[](size_type pos) { return data_[pos]; }
+
+  const_reference operator[](size_type pos) const { return data_[pos]; }
+
+  const_reference front() const { return data_[0]; }
+
+  const_reference back() const { return data_[size_ - 1]; }
+
+  T *data() { return data_; }
+
+  const T *data() const { return data_; }
+
+  iterator begin() { return data_; }
+
+  const_iterator begin() const { return data_; }
+
+  iterator end() { return data_ + size_; }
+
+  const_iterator end() const { return data_ + size_; }
+
+  const_iterator cbegin() const { return data_; }
+
+  const_iterator cend() const { return data_ + size_; }
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const {
+    return std::numeric_limits<std::size_t>::max() / sizeof(value_type) / 2;
+  }
+
+  size_type capacity() const { return capacity_; }
+
+  bool is_inline() const { return data_ == inline_data(); }
+
+  void reserve(size_type size) {
+    if (size > max_size()) {
+      throw std::out_of_range(
+          "Size can't be bigger than max size of small_vector");
+    }
+    if (size > capacity_) {
+      reallocate(size);
+    }
+  }
+
+  void shrink_to_fit() {
+    if (!is_inline() && capacity_ > size_) {
+      reallocate(std::max(size_, N));
+    }
+  }
+
+  void clear() noexcept {
+    destroy_n(data_, size_);
+    size_ = 0;
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    if (pos < cbegin() || pos > cend()) {
+      throw std::out_of_range("Invalid pos of value");
+    }
+    size_type index = static_cast<size_type>(pos - cbegin());
+    if (size_ == capacity_) {
+      realloc_emplace(index, std::forward<Args>(args)...);
+    } else if (index == size_) {
+      allocator_.construct(data_ + size_, std::forward<Args>(args)...);
+      ++size_;
+    } else {
+      T tmp(std::forward<Args>(args)...);
+      allocator_.construct(data_ + size_, std::move(data_[size_ - 1]));
+      ++size_;
+      std::move_backward(data_ + index, data_ + size_ - 2,
+                         data_ + size_ - 1);
+      data_[index] = std::move(tmp);
+    }
+    return begin() + index;
+  }
+
+  void erase(const_iterator pos) {
+    if (pos < cbegin() || pos >= cend()) {
+      throw std::out_of_range("Invalid iterator");
+    }
+    erase(pos, pos + 1);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    if (first < cbegin() || first > last || last > cend()) {
+      throw std::out_of_range("Invalid iterator");
+    }
+    size_type index = static_cast<size_type>(first - cbegin());
+    size_type count = static_cast<size_type>(last - first);
+    if (count != 0) {
+      std::move(data_ + index + count, data_ + size_, data_ + index);
+      destroy_n(data_ + size_ - count, count);
+      size_ -= count;
+    }
+    return begin() + index;
+  }
+
+  void push_back(const T &value) { emplace_back(value); }
+
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      realloc_emplace(size_, std::forward<Args>(args)...);
+    } else {
+      allocator_.construct(data_ + size_, std::forward<Args>(args)...);
+      ++size_;
+    }
+    return data_[size_ - 1];
+  }
+
+  void pop_back() {
+    if (size_ > 0) {
+      --size_;
+      allocator_.destroy(data_ + size_);
+    }
+  }
+
+  void swap(small_vector &other) {
+    small_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    if (pos < cbegin() || pos > cend()) {
+      throw std::out_of_range("Invalid pos of value");
+    }
+    size_type index = static_cast<size_type>(pos - cbegin());
+    size_type old_size = size_;
+    grow_to_fit(size_ + sizeof...(args));
+    try {
+      (emplace_back(std::forward<Args>(args)), ...);
+    } catch (...) {
+      while (size_ > old_size) pop_back();
+      throw;
+    }
+    std::rotate(data_ + index, data_ + old_size, data_ + size_);
+    return begin() + index;
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    grow_to_fit(size_ + sizeof...(args));
+    (emplace_back(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  T *inline_data() { return reinterpret_cast<T *>(buffer_); }
+
+  const T *inline_data() const { return reinterpret_cast<const T *>(buffer_); }
+
+  void destroy_n(T *first, size_type n) noexcept {
+    for (size_type i = 0; i < n; ++i) allocator_.destroy(first + i);
+  }
+
+  void uninitialized_transfer(T *src, size_type n, T *dst) {
+    size_type i = 0;
+    try {
+      for (; i < n; ++i) {
+        allocator_.construct(dst + i, std::move_if_noexcept(src[i]));
+      }
+    } catch (...) {
+      destroy_n(dst, i);
+      throw;
+    }
+  }
+
+  void relocate(T *src, size_type n, T *dst) {
+    if (n == 0) return;
+    if constexpr (is_trivially_relocatable<T>::value) {
+      std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src),
+                  n * sizeof(T));
+    } else {
+      uninitialized_transfer(src, n, dst);
+      destroy_n(src, n);
+    }
+  }
+
+  // Frees the heap buffer, if any, and points back at the inline storage.
+  void release() noexcept {
+    if (!is_inline()) allocator_.deallocate(data_, capacity_);
+    data_ = inline_data();
+    capacity_ = N;
+  }
+
+  void take(small_vector &other) {
+    if (other.is_inline()) {
+      relocate(other.data_, other.size_, data_);
+    } else {
+      data_ = other.data_;
+      capacity_ = other.capacity_;
+      other.data_ = other.inline_data();
+      other.capacity_ = N;
+    }
+    size_ = other.size_;
+    other.size_ = 0;
+  }
+
+  // new_capacity <= N moves the elements back into the inline buffer.
+  void reallocate(size_type new_capacity) {
+    T *new_data = new_capacity <= N ? inline_data()
+                                    : allocator_.allocate(new_capacity);
+    try {
+      relocate(data_, size_, new_data);
+    } catch (...) {
+      if (new_data != inline_data()) {
+        allocator_.deallocate(new_data, new_capacity);
+      }
+      throw;
+    }
+    if (!is_inline()) allocator_.deallocate(data_, capacity_);
+    data_ = new_data;
+    capacity_ = std::max(new_capacity, N);
+  }
+
+  size_type grow_capacity(size_type required) const {
+    if (required > max_size()) {
+      throw std::out_of_range(
+          "Size can't be bigger than max size of small_vector");
+    }
+    size_type next =
+        GrowthPolicy::next_capacity(capacity_, required, sizeof(T));
+    return std::max(required, std::min(next, max_size()));
+  }
+
+  void grow_to_fit(size_type required) {
+    if (required > capacity_) {
+      reallocate(grow_capacity(required));
+    }
+  }
+
+  // Spills to a bigger heap buffer with a new element built at index. The
+  // element is constructed first, so args may refer into the old buffer.
+  template <typename... Args>
+  void realloc_emplace(size_type index, Args &&...args) {
+    size_type new_capacity = grow_capacity(size_ + 1);
+    T *new_data = allocator_.allocate(new_capacity);
+    try {
+      allocator_.construct(new_data + index, std::forward<Args>(args)...);
+    } catch (...) {
+      allocator_.deallocate(new_data, new_capacity);
+      throw;
+    }
+    if constexpr (is_trivially_relocatable<T>::value) {
+      relocate(data_, index, new_data);
+      relocate(data_ + index, size_ - index, new_data + index + 1);
+    } else {
+      try {
+        uninitialized_transfer(data_, index, new_data);
+        try {
+          uninitialized_transfer(data_ + index, size_ - index,
+                                 new_data + index + 1);
+        } catch (...) {
+          destroy_n(new_data, index);
+          throw;
+        }
+      } catch (...) {
+        allocator_.destroy(new_data + index);
+        allocator_.deallocate(new_data, new_capacity);
+        throw;
+      }
+      destroy_n(data_, size_);
+    }
+    if (!is_inline()) allocator_.deallocate(data_, capacity_);
+    data_ = new_data;
+    capacity_ = new_capacity;
+    ++size_;
+  }
+};
+};  // namespace s21
+
+#endif
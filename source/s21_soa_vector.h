@@ -0,0 +1,492 @@
+#ifndef S21_SOA_VECTOR_H
+#define S21_SOA_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "growth_policy.h"
+#include "s21_span.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// vector of rows (Ts...) stored column by column: every member type gets
+// its own contiguous array, so a scan over one column reads only that
+// column's memory. column<I>() returns a span over one column, which the
+// s21 algorithms accept; iterating the container yields rows as tuples of
+// references, e.g. for (auto [id, price] : v).
+template <typename... Ts>
+class soa_vector {
+  static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one column");
+
+ public:
+  using value_type = std::tuple<Ts...>;
+  using reference = std::tuple<Ts &...>;
+  using const_reference = std::tuple<const Ts &...>;
+  using size_type = size_t;
+
+  template <std::size_t I>
+  using column_type = std::tuple_element_t<I, value_type>;
+
+  template <bool Const>
+  class row_iterator {
+    using owner = std::conditional_t<Const, const soa_vector, soa_vector>;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = soa_vector::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<Const, const_reference,
+                                         soa_vector::reference>;
+    using pointer = void;
+
+    row_iterator() : owner_(nullptr), index_(0) {}
+    row_iterator(owner *v, size_type index) : owner_(v), index_(index) {}
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    row_iterator(const row_iterator<false> &other)
+        : owner_(other.owner_), index_(other.index_) {}
+
+    reference operator*() const { return (*owner_)[index_]; }
+    reference operator[](difference_type n) const {
+      return (*owner_)[index_ + static_cast<size_type>(n)];
+    }
+    row_iterator &operator++() {
+      ++index_;
+      return *this;
+    }
+    row_iterator operator++(int) {
+      row_iterator tmp = *this;
+      ++index_;
+      return tmp;
+    }
+    row_iterator &operator--() {
+      --index_;
+      return *this;
+    }
+    row_iterator operator--(int) {
+      row_iterator tmp = *this;
+      --index_;
+      return tmp;
+    }
+    row_iterator &operator+=(difference_type n) {
+      index_ += static_cast<size_type>(n);
+      return *this;
+    }
+    row_iterator &operator-=(difference_type n) {
+      index_ -= static_cast<size_type>(n);
+      return *this;
+    }
+    row_iterator operator+(difference_type n) const {
+      return row_iterator(*this) += n;
+    }
+    row_iterator operator-(difference_type n) const {
+      return row_iterator(*this) -= n;
+    }
+    difference_type operator-(const row_iterator &other) const {
+      return static_cast<difference_type>(index_) -
+             static_cast<difference_type>(other.index_);
+    }
+    bool operator==(const row_iterator &other) const {
+      return index_ == other.index_;
+    }
+    bool operator!=(const row_iterator &other) const {
+      return index_ != other.index_;
+    }
+    bool operator<(const row_iterator &other) const {
+      return index_ < other.index_;
+    }
+
+   private:
+    friend class row_iterator<true>;
+
+    owner *owner_;
+    size_type index_;
+  };
+
+  using iterator = row_iterator<false>;
+  using const_iterator = row_iterator<true>;
+
+ private:
+  using indices = std::index_sequence_for<Ts...>;
+  static constexpr std::size_t row_bytes = (sizeof(Ts) + ...);
+
+  std::tuple<Ts *...> columns_;
+  size_type size_;
+  size_type capacity_;
+
+ public:
+  soa_vector() : columns_(), size_(0), capacity_(0) {}
+
+  soa_vector(std::initializer_list<value_type> const &rows) : soa_vector() {
+    reserve(rows.size());
+    for (const auto &row : rows) push_row(row, indices());
+  }
+
+  soa_vector(const soa_vector &other) : soa_vector() {
+    reserve(other.size_);
+    for (size_type i = 0; i < other.size_; ++i) push_row(other[i], indices());
+  }
+
+  soa_vector(soa_vector &&other) noexcept
+      : columns_(std::exchange(other.columns_, std::tuple<Ts *...>())),
+        size_(std::exchange(other.size_, 0)),
+        capacity_(std::exchange(other.capacity_, 0)) {}
+
+  ~soa_vector() {
+    clear();
+    deallocate(columns_, capacity_, indices());
+  }
+
+  soa_vector &operator=(const soa_vector &other) {
+    if (this != &other) {
+      soa_vector copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  soa_vector &operator=(soa_vector &&other) noexcept {
+    if (this != &other) {
+      clear();
+      deallocate(columns_, capacity_, indices());
+      columns_ = std::exchange(other.columns_, std::tuple<Ts *...>());
+      size_ = std::exchange(other.size_, 0);
+      capacity_ = std::exchange(other.capacity_, 0);
+    }
+    return *this;
+  }
+
+  reference operator[](size_type pos) { return row(pos, indices()); }
+
+  const_reference operator[](size_type pos) const {
+    return row(pos, indices());
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of range");
+    }
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of range");
+    }
+    return (*this)[pos];
+  }
+
+  template <std::size_t I>
+  column_type<I> *data() {
+    return std::get<I>(columns_);
+  }
+
+  template <std::size_t I>
+  const column_type<I> *data() const {
+    return std::get<I>(columns_);
+  }
+
+  template <std::size_t I>
+  span<column_type<I>> column() {
+    return span<column_type<I>>(std::get<I>(columns_), size_);
+  }
+
+  template <std::size_t I>
+  span<const column_type<I>> column() const {
+    return span<const column_type<I>>(std::get<I>(columns_), size_);
+  }
+
+  iterator begin() { return iterator(this, 0); }
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+
+  iterator end() { return iterator(this, size_); }
+
+  const_iterator end() const { return const_iterator(this, size_); }
+
+  const_iterator cbegin() const { return begin(); }
+
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const {
+    return std::numeric_limits<std::size_t>::max() / row_bytes / 2;
+  }
+
+  size_type capacity() const { return capacity_; }
+
+  void reserve(size_type size) {
+    if (size > max_size()) {
+      throw std::out_of_range(
+          "Size can't be bigger than max size of soa_vector");
+    }
+    if (size > capacity_) reallocate(size);
+  }
+
+  void shrink_to_fit() {
+    if (capacity_ > size_) reallocate(size_);
+  }
+
+  void clear() noexcept {
+    destroy_rows(0, size_, indices());
+    size_ = 0;
+  }
+
+  void resize(size_type count) {
+    if (count < size_) {
+      destroy_rows(count, size_, indices());
+      size_ = count;
+    }
+    reserve(count);
+    while (size_ < count) emplace_back(Ts()...);
+  }
+
+  // Takes one value per column.
+  template <typename... Args,
+            typename = std::enable_if_t<sizeof...(Args) == sizeof...(Ts)>>
+  void push_back(Args &&...values) {
+    emplace_back(std::forward<Args>(values)...);
+  }
+
+  void push_back(const value_type &row) { push_row(row, indices()); }
+
+  void push_back(value_type &&row) { push_row(std::move(row), indices()); }
+
+  template <typename... Args,
+            typename = std::enable_if_t<sizeof...(Args) == sizeof...(Ts)>>
+  reference emplace_back(Args &&...values) {
+    if (size_ == capacity_) {
+      // The row is built in the new columns before the old ones are freed,
+      // since values may refer to elements of this vector.
+      reallocate(grow_capacity(size_ + 1), 1, [&](std::tuple<Ts *...> &fresh) {
+        construct_row(fresh, size_, indices(), std::forward<Args>(values)...);
+      });
+    } else {
+      construct_row(columns_, size_, indices(), std::forward<Args>(values)...);
+    }
+    ++size_;
+    return (*this)[size_ - 1];
+  }
+
+  void pop_back() {
+    if (size_ > 0) {
+      destroy_rows(size_ - 1, size_, indices());
+      --size_;
+    }
+  }
+
+  void swap(soa_vector &other) noexcept {
+    std::swap(columns_, other.columns_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+  // Appends rows given as tuples (or anything std::get works on).
+  template <typename... Rows>
+  void insert_many_back(Rows &&...rows) {
+    constexpr size_type count = sizeof...(rows);
+    if (size_ + count <= capacity_) {
+      (push_row(std::forward<Rows>(rows), indices()), ...);
+      return;
+    }
+    // As in emplace_back, the rows may refer to elements of this vector, so
+    // they are all built in the new columns before the old ones go away.
+    reallocate(grow_capacity(size_ + count), count,
+               [&](std::tuple<Ts *...> &fresh) {
+                 size_type pos = size_;
+                 try {
+                   (build_row(fresh, pos++, std::forward<Rows>(rows),
+                              indices()),
+                    ...);
+                 } catch (...) {
+                   destroy_rows(fresh, size_, pos - 1, indices());
+                   throw;
+                 }
+               });
+    size_ += count;
+  }
+
+ private:
+  template <std::size_t... I>
+  reference row(size_type pos, std::index_sequence<I...>) {
+    return reference(std::get<I>(columns_)[pos]...);
+  }
+
+  template <std::size_t... I>
+  const_reference row(size_type pos, std::index_sequence<I...>) const {
+    return const_reference(std::get<I>(columns_)[pos]...);
+  }
+
+  template <typename Row, std::size_t... I>
+  void push_row(Row &&row, std::index_sequence<I...>) {
+    emplace_back(std::get<I>(std::forward<Row>(row))...);
+  }
+
+  template <typename Row, std::size_t... I>
+  void build_row(std::tuple<Ts *...> &columns, size_type pos, Row &&row,
+                 std::index_sequence<I...>) {
+    construct_row(columns, pos, indices(),
+                  std::get<I>(std::forward<Row>(row))...);
+  }
+
+  // Builds the columns of one row in order, destroying the ones already
+  // built if a later one throws.
+  template <std::size_t I = 0, std::size_t... Rest, typename Arg,
+            typename... Args>
+  void construct_row(std::tuple<Ts *...> &columns, size_type pos,
+                     std::index_sequence<I, Rest...>, Arg &&arg,
+                     Args &&...args) {
+    using T = column_type<I>;
+    T *slot = std::get<I>(columns) + pos;
+    ::new (static_cast<void *>(slot)) T(std::forward<Arg>(arg));
+    if constexpr (sizeof...(Rest) > 0) {
+      try {
+        construct_row(columns, pos, std::index_sequence<Rest...>(),
+                      std::forward<Args>(args)...);
+      } catch (...) {
+        std::destroy_at(slot);
+        throw;
+      }
+    }
+  }
+
+  template <std::size_t... I>
+  void destroy_rows(size_type first, size_type last,
+                    std::index_sequence<I...> seq) noexcept {
+    destroy_rows(columns_, first, last, seq);
+  }
+
+  template <std::size_t... I>
+  static void destroy_rows(std::tuple<Ts *...> &columns, size_type first,
+                           size_type last, std::index_sequence<I...>) noexcept {
+    (std::destroy(std::get<I>(columns) + first, std::get<I>(columns) + last),
+     ...);
+  }
+
+  template <std::size_t... I>
+  static void deallocate(const std::tuple<Ts *...> &columns,
+                         size_type capacity,
+                         std::index_sequence<I...>) noexcept {
+    (deallocate_column(std::get<I>(columns), capacity), ...);
+  }
+
+  template <typename T>
+  static void deallocate_column(T *column, size_type capacity) noexcept {
+    if (column) std::allocator<T>().deallocate(column, capacity);
+  }
+
+  template <typename T>
+  static T *allocate_column(size_type capacity) {
+    return capacity == 0 ? nullptr : std::allocator<T>().allocate(capacity);
+  }
+
+  // Moves column I into fresh, and the remaining columns after it. If a
+  // column throws, the columns already moved are destroyed in fresh and the
+  // old ones are left intact (their elements were copied unless the move
+  // constructor is noexcept).
+  template <std::size_t I = 0>
+  void transfer_columns(std::tuple<Ts *...> &fresh) {
+    if constexpr (I < sizeof...(Ts)) {
+      using T = column_type<I>;
+      T *src = std::get<I>(columns_);
+      T *dst = std::get<I>(fresh);
+      if constexpr (is_trivially_relocatable<T>::value) {
+        if (size_ != 0) {
+          std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src),
+                      size_ * sizeof(T));
+        }
+        transfer_columns<I + 1>(fresh);
+      } else {
+        if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                      !std::is_copy_constructible_v<T>) {
+          std::uninitialized_move(src, src + size_, dst);
+        } else {
+          std::uninitialized_copy(src, src + size_, dst);
+        }
+        try {
+          transfer_columns<I + 1>(fresh);
+        } catch (...) {
+          std::destroy(dst, dst + size_);
+          throw;
+        }
+      }
+    }
+  }
+
+  template <std::size_t I = 0>
+  void destroy_relocated() noexcept {
+    if constexpr (I < sizeof...(Ts)) {
+      using T = column_type<I>;
+      if constexpr (!is_trivially_relocatable<T>::value) {
+        std::destroy(std::get<I>(columns_), std::get<I>(columns_) + size_);
+      }
+      destroy_relocated<I + 1>();
+    }
+  }
+
+  template <std::size_t... I>
+  static std::tuple<Ts *...> allocate_columns(size_type capacity,
+                                              std::index_sequence<I...>) {
+    std::tuple<Ts *...> fresh;
+    try {
+      ((std::get<I>(fresh) = allocate_column<Ts>(capacity)), ...);
+    } catch (...) {
+      deallocate(fresh, capacity, indices());
+      throw;
+    }
+    return fresh;
+  }
+
+  void reallocate(size_type new_capacity) {
+    reallocate(new_capacity, 0, [](std::tuple<Ts *...> &) {});
+  }
+
+  // fill builds added rows [size_, size_ + added) in the new columns before
+  // the old rows are transferred; it cleans up after itself if it throws.
+  template <typename Fill>
+  void reallocate(size_type new_capacity, size_type added, Fill fill) {
+    std::tuple<Ts *...> fresh = allocate_columns(new_capacity, indices());
+    try {
+      fill(fresh);
+    } catch (...) {
+      deallocate(fresh, new_capacity, indices());
+      throw;
+    }
+    try {
+      transfer_columns(fresh);
+    } catch (...) {
+      destroy_rows(fresh, size_, size_ + added, indices());
+      deallocate(fresh, new_capacity, indices());
+      throw;
+    }
+    destroy_relocated();
+    deallocate(columns_, capacity_, indices());
+    columns_ = fresh;
+    capacity_ = new_capacity;
+  }
+
+  size_type grow_capacity(size_type required) const {
+    if (required > max_size()) {
+      throw std::out_of_range(
+          "Size can't be bigger than max size of soa_vector");
+    }
+    size_type next =
+        doubling_growth::next_capacity(capacity_, required, row_bytes);
+    return std::max(required, std::min(next, max_size()));
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_SOA_VECTOR_H
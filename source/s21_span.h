@@ -0,0 +1,272 @@
+#ifndef S21_SPAN_H
+#define S21_SPAN_H
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+constexpr std::size_t dynamic_extent = std::numeric_limits<std::size_t>::max();
+
+template <typename Container, typename T>
+using require_data_of = std::enable_if_t<std::is_convertible_v<
+    decltype(std::declval<Container &>().data()), T *>>;
+
+// Non-owning view of count contiguous elements. Builds from a pointer and a
+// size, a pointer range, or any container with data() and size() (vector,
+// array, small_vector, ...). span<const T> is the read-only form.
+template <typename T>
+class span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  span() : data_(nullptr), size_(0) {}
+
+  span(T *data, size_type count) : data_(data), size_(count) {}
+
+  // A template, so that span(p, 0) still picks the (pointer, count) form.
+  template <typename U, typename = std::enable_if_t<
+                            std::is_convertible_v<U (*)[], T (*)[]>>>
+  span(U *first, U *last)
+      : data_(first), size_(static_cast<size_type>(last - first)) {}
+
+  template <typename Container, typename = require_data_of<Container, T>,
+            typename = std::enable_if_t<
+                !std::is_same_v<std::remove_cv_t<Container>, span>>>
+  span(Container &c) : data_(c.data()), size_(c.size()) {}
+
+  T *data() const { return data_; }
+
+  size_type size() const { return size_; }
+
+  size_type size_bytes() const { return size_ * sizeof(T); }
+
+  bool empty() const { return size_ == 0; }
+
+  iterator begin() const { return data_; }
+
+  iterator end() const { return data_ + size_; }
+
+  const_iterator cbegin() const { return data_; }
+
+  const_iterator cend() const { return data_ + size_; }
+
+  reference operator[](size_type pos) const { return data_[pos]; }
+
+  reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of range");
+    }
+    return data_[pos];
+  }
+
+  reference front() const { return data_[0]; }
+
+  reference back() const { return data_[size_ - 1]; }
+
+  span first(size_type count) const {
+    if (count > size_) {
+      throw std::out_of_range("Span is shorter than count");
+    }
+    return span(data_, count);
+  }
+
+  span last(size_type count) const {
+    if (count > size_) {
+      throw std::out_of_range("Span is shorter than count");
+    }
+    return span(data_ + size_ - count, count);
+  }
+
+  // count == dynamic_extent takes everything after offset.
+  span subspan(size_type offset, size_type count = dynamic_extent) const {
+    if (offset > size_ ||
+        (count != dynamic_extent && count > size_ - offset)) {
+      throw std::out_of_range("Subspan is out of range");
+    }
+    return span(data_ + offset,
+                count == dynamic_extent ? size_ - offset : count);
+  }
+
+ private:
+  T *data_;
+  size_type size_;
+};
+
+template <typename Container>
+span(Container &) -> span<std::remove_pointer_t<
+    decltype(std::declval<Container &>().data())>>;
+
+// Non-owning view of every stride-th element starting at data, e.g. one
+// column of a row-major matrix or one channel of interleaved samples.
+// Elements are not contiguous, so it has iterators but no data(); use it
+// with iterator-based algorithms.
+template <typename T>
+class strided_span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using reference = T &;
+  using size_type = size_t;
+
+  // Keeps the base pointer and an index, so end() never points past the
+  // viewed storage.
+  class iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    iterator() : base_(nullptr), index_(0), stride_(1) {}
+    iterator(T *base, difference_type index, difference_type stride)
+        : base_(base), index_(index), stride_(stride) {}
+
+    reference operator*() const { return base_[index_ * stride_]; }
+    pointer operator->() const { return base_ + index_ * stride_; }
+    reference operator[](difference_type n) const {
+      return base_[(index_ + n) * stride_];
+    }
+    iterator &operator++() {
+      ++index_;
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator tmp = *this;
+      ++index_;
+      return tmp;
+    }
+    iterator &operator--() {
+      --index_;
+      return *this;
+    }
+    iterator operator--(int) {
+      iterator tmp = *this;
+      --index_;
+      return tmp;
+    }
+    iterator &operator+=(difference_type n) {
+      index_ += n;
+      return *this;
+    }
+    iterator &operator-=(difference_type n) {
+      index_ -= n;
+      return *this;
+    }
+    iterator operator+(difference_type n) const { return iterator(*this) += n; }
+    iterator operator-(difference_type n) const { return iterator(*this) -= n; }
+    difference_type operator-(const iterator &other) const {
+      return index_ - other.index_;
+    }
+    bool operator==(const iterator &other) const {
+      return index_ == other.index_;
+    }
+    bool operator!=(const iterator &other) const {
+      return index_ != other.index_;
+    }
+    bool operator<(const iterator &other) const {
+      return index_ < other.index_;
+    }
+    bool operator>(const iterator &other) const { return other < *this; }
+    bool operator<=(const iterator &other) const { return !(other < *this); }
+    bool operator>=(const iterator &other) const { return !(*this < other); }
+
+   private:
+    T *base_;
+    difference_type index_;
+    difference_type stride_;
+  };
+
+  strided_span() : data_(nullptr), size_(0), stride_(1) {}
+
+  // count elements: data[0], data[stride], ..., data[(count - 1) * stride].
+  strided_span(T *data, size_type count, size_type stride)
+      : data_(data), size_(count), stride_(stride) {
+    if (stride == 0) {
+      throw std::out_of_range("Stride must be positive");
+    }
+  }
+
+  // Every stride-th element of s, starting with the first.
+  strided_span(span<T> s, size_type stride)
+      : strided_span(s.data(),
+                     stride == 0 ? 0 : (s.size() + stride - 1) / stride,
+                     stride) {}
+
+  size_type size() const { return size_; }
+
+  bool empty() const { return size_ == 0; }
+
+  size_type stride() const { return stride_; }
+
+  iterator begin() const { return iterator(data_, 0, signed_stride()); }
+
+  iterator end() const {
+    return iterator(data_, static_cast<std::ptrdiff_t>(size_),
+                    signed_stride());
+  }
+
+  reference operator[](size_type pos) const { return data_[pos * stride_]; }
+
+  reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of range");
+    }
+    return (*this)[pos];
+  }
+
+  reference front() const { return data_[0]; }
+
+  reference back() const { return data_[(size_ - 1) * stride_]; }
+
+  strided_span first(size_type count) const {
+    if (count > size_) {
+      throw std::out_of_range("Span is shorter than count");
+    }
+    return strided_span(data_, count, stride_);
+  }
+
+  strided_span last(size_type count) const {
+    if (count > size_) {
+      throw std::out_of_range("Span is shorter than count");
+    }
+    if (count == 0) return strided_span(data_, 0, stride_);
+    return strided_span(data_ + (size_ - count) * stride_, count, stride_);
+  }
+
+  strided_span subspan(size_type offset,
+                       size_type count = dynamic_extent) const {
+    if (offset > size_ ||
+        (count != dynamic_extent && count > size_ - offset)) {
+      throw std::out_of_range("Subspan is out of range");
+    }
+    if (count == dynamic_extent) count = size_ - offset;
+    // offset * stride_ may lie past the viewed storage when nothing is left.
+    if (count == 0) return strided_span(data_, 0, stride_);
+    return strided_span(data_ + offset * stride_, count, stride_);
+  }
+
+ private:
+  std::ptrdiff_t signed_stride() const {
+    return static_cast<std::ptrdiff_t>(stride_);
+  }
+
+  T *data_;
+  size_type size_;
+  size_type stride_;
+};
+
+}  // namespace s21
+
+#endif  // S21_SPAN_H
@@ -0,0 +1,494 @@
+#ifndef S21_UNROLLED_LIST_H
+#define S21_UNROLLED_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "node_pool.h"
+#include "s21_algorithm.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Doubly linked list whose nodes each hold up to K elements contiguously,
+// so a traversal touches one node per K elements and the two link pointers
+// are shared by K values. A full node is split in half when something is
+// inserted into it, and a node that drops below half full after an erase
+// takes elements from, or merges with, its successor. Nodes come from a
+// node_pool, as in s21::list.
+//
+// Elements move within and between nodes, so insert and erase invalidate
+// iterators and references into the nodes they touch (the target node and
+// its successor); splice and sort keep every iterator of untouched nodes.
+template <typename T, size_t K = 16>
+class unrolled_list {
+  static_assert(K >= 2, "unrolled_list nodes need room for two elements");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+ private:
+  struct node {
+    node(node *p, node *n) : prev(p), next(n), count(0) {}
+    node(const node &) = delete;
+    node &operator=(const node &) = delete;
+
+    T *items() { return reinterpret_cast<T *>(storage); }
+
+    node *prev;
+    node *next;
+    size_type count;
+    alignas(T) unsigned char storage[K * sizeof(T)];
+  };
+
+ public:
+  template <bool Const>
+  class basic_iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+
+    basic_iterator() : node_(nullptr), index_(0) {}
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    basic_iterator(const basic_iterator<false> &other)
+        : node_(other.node_), index_(other.index_) {}
+
+    reference operator*() const { return node_->items()[index_]; }
+    pointer operator->() const { return node_->items() + index_; }
+    basic_iterator &operator++() {
+      if (++index_ == node_->count && node_->next) {
+        node_ = node_->next;
+        index_ = 0;
+      }
+      return *this;
+    }
+    basic_iterator operator++(int) {
+      basic_iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+    basic_iterator &operator--() {
+      if (index_ == 0) {
+        node_ = node_->prev;
+        index_ = node_->count;
+      }
+      --index_;
+      return *this;
+    }
+    basic_iterator operator--(int) {
+      basic_iterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+    bool operator==(const basic_iterator &other) const {
+      return node_ == other.node_ && index_ == other.index_;
+    }
+    bool operator!=(const basic_iterator &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    friend class unrolled_list;
+    friend class basic_iterator<true>;
+
+    // end() is one past the last element of the tail node, so every other
+    // position is kept at index < count.
+    basic_iterator(node *n, size_type index) : node_(n), index_(index) {
+      if (node_ && index_ == node_->count && node_->next) {
+        node_ = node_->next;
+        index_ = 0;
+      }
+    }
+
+    node *node_;
+    size_type index_;
+  };
+
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+ private:
+  node *head_;
+  node *tail_;
+  size_type size_;
+  size_type node_count_;
+  node_pool<node> *pool_;  // created on first use
+
+ public:
+  unrolled_list()
+      : head_(nullptr),
+        tail_(nullptr),
+        size_(0),
+        node_count_(0),
+        pool_(nullptr) {}
+
+  unrolled_list(std::initializer_list<value_type> const &items)
+      : unrolled_list() {
+    for (const auto &item : items) push_back(item);
+  }
+
+  unrolled_list(const unrolled_list &other) : unrolled_list() {
+    for (const auto &item : other) push_back(item);
+  }
+
+  unrolled_list(unrolled_list &&other) noexcept : unrolled_list() {
+    swap(other);
+  }
+
+  ~unrolled_list() {
+    clear();
+    delete pool_;
+  }
+
+  unrolled_list &operator=(const unrolled_list &other) {
+    if (this != &other) unrolled_list(other).swap(*this);
+    return *this;
+  }
+
+  unrolled_list &operator=(unrolled_list &&other) noexcept {
+    unrolled_list(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  reference front() { return head_->items()[0]; }
+
+  const_reference front() const { return head_->items()[0]; }
+
+  reference back() { return tail_->items()[tail_->count - 1]; }
+
+  const_reference back() const { return tail_->items()[tail_->count - 1]; }
+
+  iterator begin() { return iterator(head_, 0); }
+
+  iterator end() { return iterator(tail_, tail_ ? tail_->count : 0); }
+
+  const_iterator begin() const { return const_iterator(head_, 0); }
+
+  const_iterator end() const {
+    return const_iterator(tail_, tail_ ? tail_->count : 0);
+  }
+
+  const_iterator cbegin() const { return begin(); }
+
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(node) * K;
+  }
+
+  // Number of nodes in use; size() / node_count() is the fill factor.
+  size_type node_count() const { return node_count_; }
+
+  static constexpr size_type node_capacity() { return K; }
+
+  void clear() noexcept {
+    while (head_) {
+      std::destroy_n(head_->items(), head_->count);
+      drop_node(head_);
+    }
+    size_ = 0;
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    node *n = pos.node_;
+    size_type index = pos.index_;
+    if (!n || (n == tail_ && index == n->count)) {
+      emplace_back(std::forward<Args>(args)...);
+      return iterator(tail_, tail_->count - 1);
+    }
+    if (index == 0 && n->prev && n->prev->count < K) {
+      n = n->prev;
+      index = n->count;
+    } else if (n->count == K) {
+      // args may refer to an element that split() is about to move, so the
+      // value is built first.
+      T value(std::forward<Args>(args)...);
+      split(n, K / 2);
+      if (index > K / 2) {
+        n = n->next;
+        index -= K / 2;
+      }
+      construct_in(n, index, std::move(value));
+      return iterator(n, index);
+    }
+    construct_in(n, index, std::forward<Args>(args)...);
+    return iterator(n, index);
+  }
+
+  // Returns the position after the erased element.
+  iterator erase(const_iterator pos) {
+    remove_range(pos.node_, pos.index_, pos.index_ + 1);
+    return rebalance(pos.node_, pos.index_);
+  }
+
+  // Drops the nodes strictly inside the range whole, trims the two end
+  // nodes and rebalances once, so it costs O(K + nodes in the range).
+  iterator erase(const_iterator first, const_iterator last) {
+    node *n = first.node_;
+    size_type index = first.index_;
+    if (first == last) return iterator(n, index);
+    node *last_node = last.node_;
+    if (n == last_node) {
+      remove_range(n, index, last.index_);
+      return rebalance(n, index);
+    }
+    remove_range(n, index, n->count);
+    while (n->next != last_node) {
+      node *middle = n->next;
+      std::destroy_n(middle->items(), middle->count);
+      size_ -= middle->count;
+      drop_node(middle);
+    }
+    remove_range(last_node, 0, last.index_);
+    if (last_node->count == 0) {
+      drop_node(last_node);
+    } else {
+      rebalance(last_node, 0);
+    }
+    return rebalance(n, index);
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    bool fresh = !tail_ || tail_->count == K;
+    node *n = fresh ? link_node(tail_, nullptr) : tail_;
+    try {
+      construct_in(n, n->count, std::forward<Args>(args)...);
+    } catch (...) {
+      if (fresh) drop_node(n);
+      throw;
+    }
+    return n->items()[n->count - 1];
+  }
+
+  void push_front(const_reference value) { emplace_front(value); }
+
+  void push_front(T &&value) { emplace_front(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    bool fresh = !head_ || head_->count == K;
+    node *n = fresh ? link_node(nullptr, head_) : head_;
+    try {
+      construct_in(n, 0, std::forward<Args>(args)...);
+    } catch (...) {
+      if (fresh) drop_node(n);
+      throw;
+    }
+    return n->items()[0];
+  }
+
+  void pop_back() {
+    if (tail_) erase(const_iterator(tail_, tail_->count - 1));
+  }
+
+  void pop_front() {
+    if (head_) erase(begin());
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (emplace_back(std::forward<Args>(args)), ...);
+  }
+
+  void swap(unrolled_list &other) noexcept {
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(size_, other.size_);
+    std::swap(node_count_, other.node_count_);
+    std::swap(pool_, other.pool_);
+  }
+
+  // Moves every element of other before pos by relinking other's nodes.
+  // Costs O(K): at most the node at pos is split in two.
+  void splice(const_iterator pos, unrolled_list &other) {
+    if (this == &other || other.empty()) return;
+    get_pool();
+    node *before = tail_;
+    node *after = nullptr;
+    node *n = pos.node_;
+    if (n && pos.index_ == 0) {
+      before = n->prev;
+      after = n;
+    } else if (n && pos.index_ < n->count) {
+      split(n, pos.index_);
+      before = n;
+      after = n->next;
+    }
+    other.head_->prev = before;
+    other.tail_->next = after;
+    (before ? before->next : head_) = other.head_;
+    (after ? after->prev : tail_) = other.tail_;
+    size_ += other.size_;
+    node_count_ += other.node_count_;
+    other.head_ = other.tail_ = nullptr;
+    other.size_ = other.node_count_ = 0;
+  }
+
+  void sort() { sort(std::less<value_type>()); }
+
+  // Stable. Elements are moved out into a buffer, sorted there with
+  // s21::stable_sort and moved back, so the node layout stays as it is.
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ < 2) return;
+    vector<T> buffer;
+    buffer.reserve(size_);
+    iterator it = begin();
+    try {
+      for (; it != end(); ++it) buffer.push_back(std::move(*it));
+      s21::stable_sort(buffer.data(), buffer.data() + buffer.size(), comp);
+    } catch (...) {
+      move_back(buffer);
+      throw;
+    }
+    move_back(buffer);
+  }
+
+  bool operator==(const unrolled_list &other) const {
+    if (size_ != other.size_) return false;
+    const_iterator it = other.begin();
+    for (const auto &item : *this) {
+      if (!(item == *it++)) return false;
+    }
+    return true;
+  }
+
+  bool operator!=(const unrolled_list &other) const {
+    return !(*this == other);
+  }
+
+ private:
+  node_pool<node> &get_pool() {
+    if (!pool_) pool_ = new node_pool<node>();
+    return *pool_;
+  }
+
+  // New empty node between prev and next.
+  node *link_node(node *prev, node *next) {
+    node *n = ::new (static_cast<void *>(get_pool().allocate()))
+        node(prev, next);
+    (prev ? prev->next : head_) = n;
+    (next ? next->prev : tail_) = n;
+    ++node_count_;
+    return n;
+  }
+
+  // Unlinks and frees n; its elements must already be gone.
+  void drop_node(node *n) noexcept {
+    (n->prev ? n->prev->next : head_) = n->next;
+    (n->next ? n->next->prev : tail_) = n->prev;
+    --node_count_;
+    n->~node();
+    pool_->deallocate(n);
+  }
+
+  // Constructs the element at the end of n (count < K) and rotates it into
+  // place at index.
+  template <typename... Args>
+  void construct_in(node *n, size_type index, Args &&...args) {
+    T *items = n->items();
+    ::new (static_cast<void *>(items + n->count))
+        T(std::forward<Args>(args)...);
+    ++n->count;
+    ++size_;
+    std::rotate(items + index, items + n->count - 1, items + n->count);
+  }
+
+  // Moves the elements of n from index on into a new node after n.
+  void split(node *n, size_type index) {
+    node *next = link_node(n, n->next);
+    size_type moved = n->count - index;
+    try {
+      std::uninitialized_move_n(n->items() + index, moved, next->items());
+    } catch (...) {
+      drop_node(next);
+      throw;
+    }
+    std::destroy_n(n->items() + index, moved);
+    n->count = index;
+    next->count = moved;
+  }
+
+  // Removes the elements [first, last) of n, closing the gap.
+  void remove_range(node *n, size_type first, size_type last) {
+    size_type count = last - first;
+    if (count == 0) return;
+    T *items = n->items();
+    std::move(items + last, items + n->count, items + first);
+    std::destroy(items + n->count - count, items + n->count);
+    n->count -= count;
+    size_ -= count;
+  }
+
+  // Restores fill after an erase from n and returns the position of what
+  // was at index.
+  iterator rebalance(node *n, size_type index) {
+    if (n->count == 0) {
+      node *next = n->next;
+      drop_node(n);
+      return next ? iterator(next, 0) : end();
+    }
+    node *next = n->next;
+    if (next && n->count < K / 2) {
+      T *items = n->items();
+      if (n->count + next->count <= K) {
+        std::uninitialized_move_n(next->items(), next->count,
+                                  items + n->count);
+        std::destroy_n(next->items(), next->count);
+        n->count += next->count;
+        next->count = 0;
+        drop_node(next);
+      } else {
+        T *donor = next->items();
+        ::new (static_cast<void *>(items + n->count)) T(std::move(donor[0]));
+        ++n->count;
+        std::move(donor + 1, donor + next->count, donor);
+        std::destroy_at(donor + next->count - 1);
+        --next->count;
+      }
+    }
+    return iterator(n, index);
+  }
+
+  void move_back(vector<T> &buffer) {
+    iterator it = begin();
+    for (size_type i = 0; i < buffer.size(); ++i, ++it) {
+      *it = std::move(buffer[i]);
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_UNROLLED_LIST_H
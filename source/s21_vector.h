@@ -1,15 +1,40 @@
 #ifndef S21_VECTOR_H
 #define S21_VECTOR_H
 
+#include <algorithm>
+#include <cstring>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <type_traits>
+
+#include "growth_policy.h"
 
 namespace s21 {
+// Specialize for types whose move + destroy is equivalent to a byte copy so
+// that vector growth relocates them with a single memcpy.
 template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename It>
+using require_input_iterator = std::enable_if_t<std::is_convertible_v<
+    typename std::iterator_traits<It>::iterator_category,
+    std::input_iterator_tag>>;
+
+template <typename T, typename Allocator = std::allocator<T>,
+          typename GrowthPolicy = doubling_growth>
 class vector {
+  using alloc_traits = std::allocator_traits<Allocator>;
+  static_assert(std::is_same_v<typename alloc_traits::value_type, T>,
+                "Allocator::value_type must be T");
+  static_assert(std::is_same_v<typename alloc_traits::pointer, T *>,
+                "vector only supports allocators with raw pointers");
+
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
   using iterator = T *;
@@ -17,76 +42,113 @@ class vector {
   using size_type = size_t;
 
  private:
+  Allocator allocator_;
   T *data_;
   size_type capacity_;
   size_type size_;
-  std::allocator<T> allocator_;
+  size_type reallocations_ = 0;
 
  public:
-  vector() : data_(nullptr), capacity_(0), size_(0), allocator_() {}
+  vector() : vector(Allocator()) {}
+
+  explicit vector(const Allocator &alloc)
+      : allocator_(alloc), data_(nullptr), capacity_(0), size_(0) {}
 
-  explicit vector(size_t n)
-      : data_(allocator_.allocate(n)), capacity_(n), size_(n), allocator_() {
-    std::uninitialized_fill_n(data_, n, T());
+  explicit vector(size_t n, const Allocator &alloc = Allocator())
+      : vector(alloc) {
+    data_ = allocate_buffer(n);
+    capacity_ = n;
+    construct_n(data_, n);
+    size_ = n;
   }
 
-  vector(std::initializer_list<T> const &items)
-      : data_(allocator_.allocate(items.size())),
-        capacity_(items.size()),
-        size_(items.size()),
-        allocator_() {
-    std::uninitialized_copy(items.begin(), items.end(), data_);
+  vector(std::initializer_list<T> const &items,
+         const Allocator &alloc = Allocator())
+      : vector(alloc) {
+    data_ = allocate_buffer(items.size());
+    capacity_ = items.size();
+    construct_range(items.begin(), items.end(), data_);
+    size_ = items.size();
   }
 
   vector(const vector &v)
-      : data_(allocator_.allocate(v.capacity_)),
-        capacity_(v.capacity_),
-        size_(v.size_),
-        allocator_(v.allocator_) {
-    std::uninitialized_copy(v.data_, v.data_ + v.size_, data_);
+      : vector(v, alloc_traits::select_on_container_copy_construction(
+                      v.allocator_)) {}
+
+  vector(const vector &v, const Allocator &alloc) : vector(alloc) {
+    data_ = allocate_buffer(v.capacity_);
+    capacity_ = v.capacity_;
+    construct_range(v.data_, v.data_ + v.size_, data_);
+    size_ = v.size_;
   }
 
   vector(vector &&v) noexcept
-      : data_(v.data_),
+      : allocator_(std::move(v.allocator_)),
+        data_(v.data_),
         capacity_(v.capacity_),
         size_(v.size_),
-        allocator_(std::move(v.allocator_)) {
+        reallocations_(v.reallocations_) {
     v.data_ = nullptr;
     v.capacity_ = 0;
     v.size_ = 0;
   }
 
+  vector(vector &&v, const Allocator &alloc) : vector(alloc) {
+    if (allocator_ == v.allocator_) {
+      steal(v);
+    } else {
+      assign(std::make_move_iterator(v.begin()),
+             std::make_move_iterator(v.end()));
+    }
+  }
+
   ~vector() {
     clear();
-    allocator_.deallocate(data_, capacity_);
+    deallocate_buffer(data_, capacity_);
   }
 
   vector &operator=(const vector &v) {
     if (this != &v) {
-      clear();
-      allocator_.deallocate(data_, capacity_);
-      capacity_ = v.capacity_;
-      size_ = v.size_;
-      data_ = allocator_.allocate(capacity_);
-      std::uninitialized_copy(v.data_, v.data_ + v.size_, data_);
+      if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                        value) {
+        if (allocator_ != v.allocator_) {
+          clear();
+          deallocate_buffer(data_, capacity_);
+          data_ = nullptr;
+          capacity_ = 0;
+        }
+        allocator_ = v.allocator_;
+      }
+      assign(v.data_, v.data_ + v.size_);
     }
     return *this;
   }
 
-  vector &operator=(vector &&v) noexcept {
+  vector &operator=(vector &&v) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
     if (this != &v) {
-      clear();
-      allocator_.deallocate(data_, capacity_);
-      data_ = v.data_;
-      size_ = v.size_;
-      capacity_ = v.capacity_;
-      v.data_ = nullptr;
-      v.size_ = 0;
-      v.capacity_ = 0;
+      if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                        value) {
+        clear();
+        deallocate_buffer(data_, capacity_);
+        allocator_ = std::move(v.allocator_);
+        steal(v);
+      } else if (allocator_ == v.allocator_) {
+        clear();
+        deallocate_buffer(data_, capacity_);
+        steal(v);
+      } else {
+        assign(std::make_move_iterator(v.begin()),
+               std::make_move_iterator(v.end()));
+        v.clear();
+      }
     }
     return *this;
   }
 
+  allocator_type get_allocator() const { return allocator_; }
+
   reference at(size_type pos) {
     if (pos >= size_) {
       throw std::out_of_range("Index out of range");
@@ -94,14 +156,25 @@ class vector {
     return data_[pos];
   }
 
+  const_reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of range");
+    }
+    return data_[pos];
+  }
+
   reference operator[](size_type pos) { return data_[pos]; }
 
+  const_reference operator[](size_type pos) const { return data_[pos]; }
+
   const_reference front() const { return data_[0]; }
 
   const_reference back() const { return data_[size_ - 1]; }
 
   T *data() { return data_; }
 
+  const T *data() const { return data_; }
+
   iterator begin() { return iterator(data_); }
 
   iterator end() { return iterator(data_ + size_); }
@@ -110,12 +183,14 @@ class vector {
 
   const_iterator cend() { return const_iterator(data_ + size_); }
 
-  bool empty() { return size_ == 0; }
+  bool empty() const { return size_ == 0; }
 
-  size_t size() { return size_; }
+  size_t size() const { return size_; }
 
   size_type max_size() const {
-    return std::numeric_limits<std::size_t>::max() / sizeof(value_type) / 2;
+    return std::min<size_type>(
+        alloc_traits::max_size(allocator_),
+        std::numeric_limits<std::size_t>::max() / sizeof(value_type) / 2);
   }
 
   void reserve(size_type size) {
@@ -123,55 +198,149 @@ class vector {
       throw std::out_of_range("Size can't be bigger than max size of vector");
     }
     if (size > capacity_) {
-      T *new_data = allocator_.allocate(size);
-      std::uninitialized_copy(data_, data_ + size_, new_data);
-      for (size_t i = 0; i < size_; ++i) {
-        allocator_.destroy(&data_[i]);
-      }
-      allocator_.deallocate(data_, capacity_);
-      data_ = new_data;
-      capacity_ = size;
+      reallocate(size);
     }
   }
 
   size_type capacity() const { return capacity_; }
 
+  size_type reallocations() const { return reallocations_; }
+
+  void resize(size_type count) { resize_with(count); }
+
+  void resize(size_type count, const_reference value) {
+    resize_with(count, value);
+  }
+
+  // Like resize(), but new elements are default-initialized: trivially
+  // constructible ones are left uninitialized for the caller to overwrite.
+  void resize_for_overwrite(size_type count) {
+    if (count <= size_) {
+      destroy_n(data_ + count, size_ - count);
+      size_ = count;
+      return;
+    }
+    grow_to_fit(count);
+    if constexpr (!std::is_trivially_default_constructible_v<T>) {
+      size_type i = size_;
+      try {
+        for (; i < count; ++i) ::new (static_cast<void *>(data_ + i)) T;
+      } catch (...) {
+        destroy_n(data_ + size_, i - size_);
+        throw;
+      }
+    }
+    size_ = count;
+  }
+
   void shrink_to_fit() {
     if (capacity_ > size_) {
-      T *new_data = allocator_.allocate(size_);
-      std::uninitialized_copy(data_, data_ + size_, new_data);
-      for (size_t i = 0; i < size_; ++i) {
-        allocator_.destroy(&data_[i]);
-      }
-      allocator_.deallocate(data_, capacity_);
-      data_ = new_data;
-      capacity_ = size_;
+      reallocate(size_);
     }
   }
 
   void clear() noexcept {
-    for (size_t i = 0; i < size_; ++i) {
-      allocator_.destroy(&data_[i]);
-    }
+    destroy_n(data_, size_);
     size_ = 0;
   }
 
   iterator insert(iterator pos, const_reference value) {
-    if (pos >= begin() && pos <= end()) {
-      size_type index = static_cast<size_type>(pos - begin());
-      if (size_ == capacity_) {
-        reserve(capacity_ + 1);
+    return emplace(pos, value);
+  }
+
+  iterator insert(iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    if (pos < cbegin() || pos > cend()) {
+      throw std::out_of_range("Invalid pos of value");
+    }
+    size_type index = static_cast<size_type>(pos - cbegin());
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      insert_forward(index, first, last);
+    } else {
+      size_type old_size = size_;
+      try {
+        for (; first != last; ++first) emplace_back(*first);
+      } catch (...) {
+        while (size_ > old_size) pop_back();
+        throw;
       }
-      for (size_type i = size_; i > index; --i) {
-        allocator_.construct(&data_[i], std::move(data_[i - 1]));
-        allocator_.destroy(&data_[i - 1]);
+      std::rotate(data_ + index, data_ + old_size, data_ + size_);
+    }
+    return begin() + index;
+  }
+
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  void assign(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      size_type n = static_cast<size_type>(std::distance(first, last));
+      if (n > capacity_) {
+        if (n > max_size()) {
+          throw std::out_of_range(
+              "Size can't be bigger than max size of vector");
+        }
+        T *new_data = allocate_buffer(n);
+        try {
+          construct_range(first, last, new_data);
+        } catch (...) {
+          deallocate_buffer(new_data, n);
+          throw;
+        }
+        clear();
+        deallocate_buffer(data_, capacity_);
+        data_ = new_data;
+        capacity_ = n;
+        size_ = n;
+        ++reallocations_;
+      } else if (n > size_) {
+        InputIt mid = std::next(first, static_cast<std::ptrdiff_t>(size_));
+        std::copy(first, mid, data_);
+        construct_range(mid, last, data_ + size_);
+        size_ = n;
+      } else {
+        std::copy(first, last, data_);
+        destroy_n(data_ + n, size_ - n);
+        size_ = n;
       }
-      allocator_.construct(&data_[index], value);
-      ++size_;
-      return begin() + index;
     } else {
+      clear();
+      for (; first != last; ++first) emplace_back(*first);
+    }
+  }
+
+  template <typename Range>
+  void append_range(Range &&range) {
+    insert(cend(), std::begin(range), std::end(range));
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    if (pos < cbegin() || pos > cend()) {
       throw std::out_of_range("Invalid pos of value");
     }
+    size_type index = static_cast<size_type>(pos - cbegin());
+    if (size_ == capacity_) {
+      realloc_emplace(index, grow_capacity(size_ + 1),
+                      std::forward<Args>(args)...);
+    } else if (index == size_) {
+      alloc_traits::construct(allocator_, data_ + size_,
+                              std::forward<Args>(args)...);
+      ++size_;
+    } else {
+      T tmp(std::forward<Args>(args)...);
+      alloc_traits::construct(allocator_, data_ + size_,
+                              std::move(data_[size_ - 1]));
+      ++size_;
+      std::move_backward(data_ + index, data_ + size_ - 2,
+                         data_ + size_ - 1);
+      data_[index] = std::move(tmp);
+    }
+    return begin() + index;
   }
 
   void erase(iterator pos) {
@@ -179,72 +348,95 @@ class vector {
       size_type index = static_cast<size_type>(pos - begin());
       std::move(data_ + index + 1, data_ + size_, data_ + index);
       --size_;
-      allocator_.destroy(data_ + size_);
+      alloc_traits::destroy(allocator_, data_ + size_);
     } else {
       throw std::out_of_range("Invalid iterator");
     }
   }
 
-  void push_back(const T &value) {
+  iterator erase(const_iterator first, const_iterator last) {
+    if (first < cbegin() || first > last || last > cend()) {
+      throw std::out_of_range("Invalid iterator");
+    }
+    size_type index = static_cast<size_type>(first - cbegin());
+    if (first != last) {
+      T *new_end = std::move(last, data_ + size_, first);
+      destroy_n(new_end, static_cast<size_type>(data_ + size_ - new_end));
+      size_ = static_cast<size_type>(new_end - data_);
+    }
+    return begin() + index;
+  }
+
+  void push_back(const T &value) { emplace_back(value); }
+
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
     if (size_ == capacity_) {
-      reserve(capacity_ == 0 ? 1 : 2 * capacity_);
+      realloc_emplace(size_, grow_capacity(size_ + 1),
+                      std::forward<Args>(args)...);
+    } else {
+      alloc_traits::construct(allocator_, data_ + size_,
+                              std::forward<Args>(args)...);
+      ++size_;
     }
-    allocator_.construct(data_ + size_, value);
-    ++size_;
+    return data_[size_ - 1];
   }
 
   void pop_back() {
     if (size_ > 0) {
       --size_;
-      allocator_.destroy(data_ + size_);
+      alloc_traits::destroy(allocator_, data_ + size_);
     }
   }
 
-  void swap(vector &other) {
+  void swap(vector &other) noexcept {
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(allocator_, other.allocator_);
+    }
     std::swap(data_, other.data_);
     std::swap(size_, other.size_);
     std::swap(capacity_, other.capacity_);
+    std::swap(reallocations_, other.reallocations_);
   }
 
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args) {
-    size_t index = static_cast<size_t>(pos - cbegin());
-    size_t num_elements = sizeof...(args);
-    size_t new_size = size_ + num_elements;
-
-    if (new_size > capacity_) {
-      reserve(new_size);
+    if (pos < cbegin() || pos > cend()) {
+      throw std::out_of_range("Invalid pos of value");
     }
-
-    iterator it = begin() + index;
-    std::move_backward(it, end(), end() + num_elements);
-
-    size_t i = 0;
-    (void)std::initializer_list<int>{
-        (data_[index + i++] = std::forward<Args>(args), 0)...};
-
-    size_ = new_size;
-    return it;
+    size_type index = static_cast<size_type>(pos - cbegin());
+    size_type old_size = size_;
+    grow_to_fit(size_ + sizeof...(args));
+    try {
+      (emplace_back(std::forward<Args>(args)), ...);
+    } catch (...) {
+      while (size_ > old_size) pop_back();
+      throw;
+    }
+    std::rotate(data_ + index, data_ + old_size, data_ + size_);
+    return begin() + index;
   }
 
   template <typename... Args>
   void insert_many_back(Args &&...args) {
-    size_t new_size = size_ + sizeof...(args);
-    if (new_size > capacity_) {
-      reserve(new_size);
-    }
-    (push_back(std::forward<Args>(args)), ...);
+    grow_to_fit(size_ + sizeof...(args));
+    (emplace_back(std::forward<Args>(args)), ...);
   }
 
   void reallocate(size_t new_capacity) {
-    T *new_data = allocator_.allocate(new_capacity);
-    for (size_t i = 0; i < size_; ++i) {
-      allocator_.construct(&new_data[i], std::move(data_[i]));
-      allocator_.destroy(&data_[i]);
+    T *new_data = allocate_buffer(new_capacity);
+    try {
+      relocate(data_, size_, new_data);
+    } catch (...) {
+      deallocate_buffer(new_data, new_capacity);
+      throw;
     }
-    allocator_.deallocate(data_, capacity_);
+    deallocate_buffer(data_, capacity_);
     data_ = new_data;
     capacity_ = new_capacity;
+    ++reallocations_;
   }
 
   void print() const {
@@ -253,7 +445,202 @@ class vector {
     }
     std::cout << std::endl;
   }
+
+ private:
+  T *allocate_buffer(size_type n) {
+    return n ? alloc_traits::allocate(allocator_, n) : nullptr;
+  }
+
+  void deallocate_buffer(T *p, size_type n) noexcept {
+    if (p) alloc_traits::deallocate(allocator_, p, n);
+  }
+
+  void steal(vector &v) noexcept {
+    data_ = v.data_;
+    size_ = v.size_;
+    capacity_ = v.capacity_;
+    reallocations_ = v.reallocations_;
+    v.data_ = nullptr;
+    v.size_ = 0;
+    v.capacity_ = 0;
+  }
+
+  size_type grow_capacity(size_type required) const {
+    if (required > max_size()) {
+      throw std::out_of_range("Size can't be bigger than max size of vector");
+    }
+    size_type next =
+        GrowthPolicy::next_capacity(capacity_, required, sizeof(T));
+    return std::max(required, std::min(next, max_size()));
+  }
+
+  void grow_to_fit(size_type required) {
+    if (required > capacity_) {
+      reallocate(grow_capacity(required));
+    }
+  }
+
+  void destroy_n(T *first, size_type n) noexcept {
+    for (size_type i = 0; i < n; ++i) {
+      alloc_traits::destroy(allocator_, first + i);
+    }
+  }
+
+  // Moves n elements into uninitialized dst, copying instead when T's move
+  // constructor may throw. On failure dst is cleaned up and src is intact.
+  void uninitialized_transfer(T *src, size_type n, T *dst) {
+    size_type i = 0;
+    try {
+      for (; i < n; ++i) {
+        alloc_traits::construct(allocator_, dst + i,
+                                std::move_if_noexcept(src[i]));
+      }
+    } catch (...) {
+      destroy_n(dst, i);
+      throw;
+    }
+  }
+
+  void relocate(T *src, size_type n, T *dst) {
+    if (n == 0) return;
+    if constexpr (is_trivially_relocatable<T>::value) {
+      std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src),
+                  n * sizeof(T));
+    } else {
+      uninitialized_transfer(src, n, dst);
+      destroy_n(src, n);
+    }
+  }
+
+  // Grows to new_capacity leaving a gap of count elements at index, which
+  // fill(dst) constructs. The gap is filled before the old buffer is
+  // touched, so the new elements may be built from references into it.
+  template <typename Fill>
+  void realloc_insert(size_type index, size_type count,
+                      size_type new_capacity, Fill fill) {
+    T *new_data = allocate_buffer(new_capacity);
+    try {
+      fill(new_data + index);
+    } catch (...) {
+      deallocate_buffer(new_data, new_capacity);
+      throw;
+    }
+    if constexpr (is_trivially_relocatable<T>::value) {
+      relocate(data_, index, new_data);
+      relocate(data_ + index, size_ - index, new_data + index + count);
+    } else {
+      try {
+        uninitialized_transfer(data_, index, new_data);
+        try {
+          uninitialized_transfer(data_ + index, size_ - index,
+                                 new_data + index + count);
+        } catch (...) {
+          destroy_n(new_data, index);
+          throw;
+        }
+      } catch (...) {
+        destroy_n(new_data + index, count);
+        deallocate_buffer(new_data, new_capacity);
+        throw;
+      }
+      destroy_n(data_, size_);
+    }
+    deallocate_buffer(data_, capacity_);
+    data_ = new_data;
+    capacity_ = new_capacity;
+    ++reallocations_;
+    size_ += count;
+  }
+
+  template <typename... Args>
+  void realloc_emplace(size_type index, size_type new_capacity,
+                       Args &&...args) {
+    realloc_insert(index, 1, new_capacity, [&](T *dst) {
+      alloc_traits::construct(allocator_, dst, std::forward<Args>(args)...);
+    });
+  }
+
+  template <typename... Args>
+  void resize_with(size_type count, const Args &...args) {
+    if (count <= size_) {
+      destroy_n(data_ + count, size_ - count);
+      size_ = count;
+    } else if (count > capacity_) {
+      realloc_insert(size_, count - size_, grow_capacity(count), [&](T *dst) {
+        construct_n(dst, count - size_, args...);
+      });
+    } else {
+      construct_n(data_ + size_, count - size_, args...);
+      size_ = count;
+    }
+  }
+
+  template <typename... Args>
+  void construct_n(T *dst, size_type n, const Args &...args) {
+    size_type i = 0;
+    try {
+      for (; i < n; ++i) alloc_traits::construct(allocator_, dst + i, args...);
+    } catch (...) {
+      destroy_n(dst, i);
+      throw;
+    }
+  }
+
+  template <typename It>
+  void construct_range(It first, It last, T *dst) {
+    T *cur = dst;
+    try {
+      for (; first != last; ++first, ++cur) {
+        alloc_traits::construct(allocator_, cur, *first);
+      }
+    } catch (...) {
+      destroy_n(dst, static_cast<size_type>(cur - dst));
+      throw;
+    }
+  }
+
+  // Inserts a sized range with at most one reallocation and a single shift
+  // of the elements after index.
+  template <typename ForwardIt>
+  void insert_forward(size_type index, ForwardIt first, ForwardIt last) {
+    size_type n = static_cast<size_type>(std::distance(first, last));
+    if (n == 0) return;
+    if (size_ + n > capacity_) {
+      realloc_insert(index, n, grow_capacity(size_ + n),
+                     [&](T *dst) { construct_range(first, last, dst); });
+      return;
+    }
+    T *pos = data_ + index;
+    T *old_end = data_ + size_;
+    size_type elems_after = size_ - index;
+    if (elems_after > n) {
+      uninitialized_transfer(old_end - n, n, old_end);
+      size_ += n;
+      std::move_backward(pos, old_end - n, old_end);
+      std::copy(first, last, pos);
+    } else {
+      ForwardIt mid =
+          std::next(first, static_cast<std::ptrdiff_t>(elems_after));
+      construct_range(mid, last, old_end);
+      size_ += n - elems_after;
+      uninitialized_transfer(pos, elems_after, data_ + size_);
+      size_ += elems_after;
+      std::copy(first, mid, pos);
+    }
+  }
 };
+
+template <typename T, typename Allocator, typename GrowthPolicy,
+          typename Pred>
+typename vector<T, Allocator, GrowthPolicy>::size_type erase_if(
+    vector<T, Allocator, GrowthPolicy> &v, Pred pred) {
+  auto new_end = std::remove_if(v.begin(), v.end(), pred);
+  auto removed =
+      static_cast<typename vector<T, Allocator, GrowthPolicy>::size_type>(
+          v.end() - new_end);
+  v.erase(new_end, v.end());
+  return removed;
+}
 };  // namespace s21
 
 #endif
\ No newline at end of file
@@ -0,0 +1,230 @@
+#ifndef S21_SIMD_H
+#define S21_SIMD_H
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace s21 {
+namespace simd {
+
+enum class level { scalar, sse2, avx2, avx512 };
+
+// Word-wise operations for bitwise(): dst = dst OP src.
+enum class bit_op { and_op, or_op, xor_op, and_not_op };
+
+// Element types the kernels handle: plain integers and float/double.
+template <typename T>
+struct is_vectorizable
+    : std::bool_constant<std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                         !std::is_same_v<T, long double> &&
+                         (sizeof(T) == 1 || sizeof(T) == 2 ||
+                          sizeof(T) == 4 || sizeof(T) == 8)> {};
+
+inline level detected_level() {
+#ifdef S21_SIMD_X86
+  static const level detected = [] {
+    __builtin_cpu_init();
+    // The wider kernels also use the popcnt instruction, which every CPU
+    // with AVX2 has.
+    bool popcnt = __builtin_cpu_supports("popcnt");
+    if (popcnt && __builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512bw")) {
+      return level::avx512;
+    }
+    if (popcnt && __builtin_cpu_supports("avx2")) return level::avx2;
+    if (__builtin_cpu_supports("sse2")) return level::sse2;
+    return level::scalar;
+  }();
+  return detected;
+#else
+  return level::scalar;
+#endif
+}
+
+inline std::atomic<level> &current_level() {
+  static std::atomic<level> current(detected_level());
+  return current;
+}
+
+inline level active_level() {
+  return current_level().load(std::memory_order_relaxed);
+}
+
+// Restricts dispatch to at most l (never above what the CPU supports).
+// Meant for tests and benchmarks.
+inline void force_level(level l) {
+  current_level().store(std::min(l, detected_level()),
+                        std::memory_order_relaxed);
+}
+
+namespace scalar {
+
+template <typename T>
+const T *find(const T *first, const T *last, T value) {
+  for (; first != last; ++first) {
+    if (*first == value) return first;
+  }
+  return last;
+}
+
+template <typename T>
+std::size_t count(const T *first, const T *last, T value) {
+  std::size_t result = 0;
+  for (; first != last; ++first) {
+    if (*first == value) ++result;
+  }
+  return result;
+}
+
+template <bool Greater, typename T>
+const T *extremum(const T *first, const T *last) {
+  const T *best = first;
+  for (; first != last; ++first) {
+    if (Greater ? *best < *first : *first < *best) best = first;
+  }
+  return best;
+}
+
+template <typename T>
+bool equal(const T *first1, const T *last1, const T *first2) {
+  for (; first1 != last1; ++first1, ++first2) {
+    if (!(*first1 == *first2)) return false;
+  }
+  return true;
+}
+
+template <typename T>
+void fill(T *first, T *last, T value) {
+  for (; first != last; ++first) *first = value;
+}
+
+template <bit_op Op, typename T>
+void bitwise(T *dst, const T *src, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) {
+    if constexpr (Op == bit_op::and_op) {
+      dst[i] &= src[i];
+    } else if constexpr (Op == bit_op::or_op) {
+      dst[i] |= src[i];
+    } else if constexpr (Op == bit_op::xor_op) {
+      dst[i] ^= src[i];
+    } else {
+      dst[i] &= ~src[i];
+    }
+  }
+}
+
+inline std::size_t popcount(const std::uint64_t *first,
+                            const std::uint64_t *last) {
+  std::size_t result = 0;
+  for (; first != last; ++first) {
+    result += static_cast<std::size_t>(__builtin_popcountll(*first));
+  }
+  return result;
+}
+
+}  // namespace scalar
+
+#ifdef S21_SIMD_X86
+#define S21_SIMD_NS sse2
+#define S21_SIMD_TARGET "sse2"
+#define S21_SIMD_BYTES 16
+#define S21_SIMD_ANY(m) (_mm_movemask_epi8((__m128i)(m)) != 0)
+#include "simd_kernels.inc"
+#undef S21_SIMD_NS
+#undef S21_SIMD_TARGET
+#undef S21_SIMD_BYTES
+#undef S21_SIMD_ANY
+
+#define S21_SIMD_NS avx2
+#define S21_SIMD_TARGET "avx2,popcnt"
+#define S21_SIMD_BYTES 32
+#define S21_SIMD_ANY(m) (!_mm256_testz_si256((__m256i)(m), (__m256i)(m)))
+#include "simd_kernels.inc"
+#undef S21_SIMD_NS
+#undef S21_SIMD_TARGET
+#undef S21_SIMD_BYTES
+#undef S21_SIMD_ANY
+
+#define S21_SIMD_NS avx512
+#define S21_SIMD_TARGET "avx512f,avx512bw,popcnt"
+#define S21_SIMD_BYTES 64
+#define S21_SIMD_ANY(m) \
+  (_mm512_test_epi64_mask((__m512i)(m), (__m512i)(m)) != 0)
+#include "simd_kernels.inc"
+#undef S21_SIMD_NS
+#undef S21_SIMD_TARGET
+#undef S21_SIMD_BYTES
+#undef S21_SIMD_ANY
+
+#define S21_SIMD_DISPATCH(name, ...)                             \
+  switch (active_level()) {                                      \
+    case level::avx512:                                          \
+      return avx512::name(__VA_ARGS__);                          \
+    case level::avx2:                                            \
+      return avx2::name(__VA_ARGS__);                            \
+    case level::sse2:                                            \
+      return sse2::name(__VA_ARGS__);                            \
+    default:                                                     \
+      return scalar::name(__VA_ARGS__);                          \
+  }
+#else
+#define S21_SIMD_DISPATCH(name, ...) return scalar::name(__VA_ARGS__);
+#endif
+
+template <typename T>
+const T *find(const T *first, const T *last, T value) {
+  S21_SIMD_DISPATCH(find, first, last, value)
+}
+
+template <typename T>
+std::size_t count(const T *first, const T *last, T value) {
+  S21_SIMD_DISPATCH(count, first, last, value)
+}
+
+template <typename T>
+const T *min_element(const T *first, const T *last) {
+  S21_SIMD_DISPATCH(template extremum<false>, first, last)
+}
+
+template <typename T>
+const T *max_element(const T *first, const T *last) {
+  S21_SIMD_DISPATCH(template extremum<true>, first, last)
+}
+
+template <typename T>
+bool equal(const T *first1, const T *last1, const T *first2) {
+  S21_SIMD_DISPATCH(equal, first1, last1, first2)
+}
+
+template <typename T>
+void fill(T *first, T *last, T value) {
+  S21_SIMD_DISPATCH(fill, first, last, value)
+}
+
+template <bit_op Op, typename T>
+void bitwise(T *dst, const T *src, std::size_t n) {
+  S21_SIMD_DISPATCH(template bitwise<Op>, dst, src, n)
+}
+
+inline std::size_t popcount(const std::uint64_t *first,
+                            const std::uint64_t *last) {
+  S21_SIMD_DISPATCH(popcount, first, last)
+}
+
+#undef S21_SIMD_DISPATCH
+
+}  // namespace simd
+}  // namespace s21
+
+#endif  // S21_SIMD_H
@@ -0,0 +1,199 @@
+#ifndef S21_THREAD_POOL_H
+#define S21_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+// Work-stealing pool: every worker owns a deque, takes its own tasks from
+// the back and steals from the front of the others when it runs dry.
+// Threads outside the pool submit round-robin and may help by calling
+// run_one(), which is how task_group::wait() avoids blocking a worker.
+class thread_pool {
+ public:
+  explicit thread_pool(std::size_t threads = default_threads())
+      : queues_(), workers_(), sleep_mutex_(), wake_(), queued_(0),
+        next_queue_(0), stop_(false) {
+    threads = std::max<std::size_t>(threads, 1);
+    for (std::size_t i = 0; i < threads; ++i) {
+      queues_.push_back(std::make_unique<queue>());
+    }
+    for (std::size_t i = 0; i < threads; ++i) {
+      workers_.emplace_back([this, i] { work(i); });
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto &worker : workers_) worker.join();
+  }
+
+  static std::size_t default_threads() {
+    return std::max(1U, std::thread::hardware_concurrency());
+  }
+
+  static thread_pool &instance() {
+    static thread_pool pool;
+    return pool;
+  }
+
+  std::size_t size() const { return workers_.size(); }
+
+  void submit(std::function<void()> task) {
+    std::size_t index = current_worker().pool == this
+                            ? current_worker().index
+                            : next_queue_++ % queues_.size();
+    {
+      std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+      queues_[index]->tasks.push_back(std::move(task));
+    }
+    queued_.fetch_add(1, std::memory_order_release);
+    { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+    wake_.notify_one();
+  }
+
+  // Runs one pending task, if there is any. Returns false otherwise.
+  bool run_one() {
+    std::function<void()> task;
+    std::size_t home = current_worker().pool == this ? current_worker().index
+                                                     : queues_.size();
+    if (home < queues_.size() && pop_back(home, task)) {
+      task();
+      return true;
+    }
+    for (std::size_t i = 0; i < queues_.size(); ++i) {
+      if (i != home && pop_front(i, task)) {
+        task();
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  struct queue {
+    queue() : mutex(), tasks() {}
+
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  struct worker_id {
+    thread_pool *pool = nullptr;
+    std::size_t index = 0;
+  };
+
+  static worker_id &current_worker() {
+    static thread_local worker_id id;
+    return id;
+  }
+
+  bool pop_back(std::size_t index, std::function<void()> &task) {
+    std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+    if (queues_[index]->tasks.empty()) return false;
+    task = std::move(queues_[index]->tasks.back());
+    queues_[index]->tasks.pop_back();
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  bool pop_front(std::size_t index, std::function<void()> &task) {
+    std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+    if (queues_[index]->tasks.empty()) return false;
+    task = std::move(queues_[index]->tasks.front());
+    queues_[index]->tasks.pop_front();
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  void work(std::size_t index) {
+    current_worker().pool = this;
+    current_worker().index = index;
+    while (true) {
+      if (run_one()) continue;
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      wake_.wait(lock, [this] {
+        return stop_ || queued_.load(std::memory_order_acquire) > 0;
+      });
+      if (stop_ && queued_.load(std::memory_order_acquire) == 0) return;
+    }
+  }
+
+  std::vector<std::unique_ptr<queue>> queues_;
+  std::vector<std::thread> workers_;
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  std::atomic<std::size_t> queued_;
+  std::atomic<std::size_t> next_queue_;
+  bool stop_;
+};
+
+// Fork-join helper: run() hands tasks to the pool, wait() executes pending
+// tasks until all of this group's tasks are done and rethrows the first
+// exception one of them threw.
+class task_group {
+ public:
+  explicit task_group(thread_pool &pool = thread_pool::instance())
+      : pool_(pool), pending_(0), error_mutex_(), error_() {}
+
+  task_group(const task_group &) = delete;
+  task_group &operator=(const task_group &) = delete;
+
+  ~task_group() {
+    while (pending_.load(std::memory_order_acquire) != 0) help();
+  }
+
+  template <typename F>
+  void run(F f) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    pool_.submit([this, f = std::move(f)]() mutable {
+      try {
+        f();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        if (!error_) error_ = std::current_exception();
+      }
+      pending_.fetch_sub(1, std::memory_order_acq_rel);
+    });
+  }
+
+  void wait() {
+    while (pending_.load(std::memory_order_acquire) != 0) help();
+    if (error_) {
+      std::exception_ptr error = std::move(error_);
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+ private:
+  void help() {
+    if (!pool_.run_one()) std::this_thread::yield();
+  }
+
+  thread_pool &pool_;
+  std::atomic<std::size_t> pending_;
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+};
+
+}  // namespace s21
+
+#endif  // S21_THREAD_POOL_H
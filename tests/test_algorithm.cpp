@@ -0,0 +1,304 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus/s21_containersplus.h"
+
+namespace {
+
+const s21::simd::level kLevels[] = {
+    s21::simd::level::scalar, s21::simd::level::sse2, s21::simd::level::avx2,
+    s21::simd::level::avx512};
+
+class SimdLevelGuard {
+ public:
+  SimdLevelGuard() : saved_(s21::simd::active_level()) {}
+  ~SimdLevelGuard() { s21::simd::force_level(saved_); }
+  SimdLevelGuard(const SimdLevelGuard &) = delete;
+  SimdLevelGuard &operator=(const SimdLevelGuard &) = delete;
+
+ private:
+  s21::simd::level saved_;
+};
+
+template <typename T>
+void CheckAgainstStd() {
+  SimdLevelGuard guard;
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> dist(0, 9);
+  for (auto level : kLevels) {
+    s21::simd::force_level(level);
+    for (size_t size : {0U, 1U, 7U, 31U, 64U, 100U, 257U, 1000U}) {
+      s21::vector<T> s21_vector;
+      std::vector<T> std_vector;
+      for (size_t i = 0; i < size; ++i) {
+        T value = static_cast<T>(dist(gen));
+        s21_vector.push_back(value);
+        std_vector.push_back(value);
+      }
+      for (int needle = 0; needle <= 10; ++needle) {
+        T value = static_cast<T>(needle);
+        EXPECT_EQ(s21::find(s21_vector, value) - s21_vector.begin(),
+                  std::find(std_vector.begin(), std_vector.end(), value) -
+                      std_vector.begin());
+        EXPECT_EQ(s21::count(s21_vector, value),
+                  static_cast<size_t>(
+                      std::count(std_vector.begin(), std_vector.end(), value)));
+        EXPECT_EQ(s21::contains(s21_vector, value),
+                  std::find(std_vector.begin(), std_vector.end(), value) !=
+                      std_vector.end());
+      }
+      EXPECT_EQ(s21::min_element(s21_vector) - s21_vector.begin(),
+                std::min_element(std_vector.begin(), std_vector.end()) -
+                    std_vector.begin());
+      EXPECT_EQ(s21::max_element(s21_vector) - s21_vector.begin(),
+                std::max_element(std_vector.begin(), std_vector.end()) -
+                    std_vector.begin());
+      s21::vector<T> copy = s21_vector;
+      EXPECT_TRUE(s21::equal(s21_vector, copy));
+      if (size > 0) {
+        copy[size - 1] = static_cast<T>(copy[size - 1] + 1);
+        EXPECT_FALSE(s21::equal(s21_vector, copy));
+      }
+      s21::fill(copy, static_cast<T>(3));
+      EXPECT_EQ(s21::count(copy, static_cast<T>(3)), size);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(Algorithm, TestInt8) { CheckAgainstStd<std::int8_t>(); }
+
+TEST(Algorithm, TestUint16) { CheckAgainstStd<std::uint16_t>(); }
+
+TEST(Algorithm, TestInt32) { CheckAgainstStd<std::int32_t>(); }
+
+TEST(Algorithm, TestInt64) { CheckAgainstStd<std::int64_t>(); }
+
+TEST(Algorithm, TestFloat) { CheckAgainstStd<float>(); }
+
+TEST(Algorithm, TestDouble) { CheckAgainstStd<double>(); }
+
+TEST(Algorithm, TestCountLongRun) {
+  SimdLevelGuard guard;
+  for (auto level : kLevels) {
+    s21::simd::force_level(level);
+    s21::vector<char> s21_vector(100000);
+    s21::fill(s21_vector, 'x');
+    s21_vector[500] = 'y';
+    EXPECT_EQ(s21::count(s21_vector, 'x'), 99999U);
+    EXPECT_EQ(s21::find(s21_vector, 'y') - s21_vector.begin(), 500);
+  }
+}
+
+TEST(Algorithm, TestNaN) {
+  SimdLevelGuard guard;
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  for (auto level : kLevels) {
+    s21::simd::force_level(level);
+    s21::vector<double> s21_vector(40);
+    s21_vector[0] = nan;
+    s21_vector[5] = -1.0;
+    EXPECT_EQ(s21::min_element(s21_vector), s21_vector.begin());
+    s21_vector[0] = 2.0;
+    s21_vector[17] = nan;
+    s21_vector[30] = -1.0;
+    EXPECT_EQ(s21::min_element(s21_vector) - s21_vector.begin(), 5);
+    EXPECT_EQ(s21::max_element(s21_vector) - s21_vector.begin(), 0);
+    EXPECT_FALSE(s21::contains(s21_vector, nan));
+    s21::vector<double> copy = s21_vector;
+    EXPECT_FALSE(s21::equal(s21_vector, copy));
+  }
+}
+
+TEST(Algorithm, TestArray) {
+  s21::array<float, 37> s21_array;
+  s21::fill(s21_array, 1.5f);
+  s21_array[36] = 0.5f;
+  s21_array[20] = 9.0f;
+  EXPECT_EQ(s21::count(s21_array, 1.5f), 35U);
+  EXPECT_EQ(s21::min_element(s21_array) - s21_array.begin(), 36);
+  EXPECT_EQ(s21::max_element(s21_array) - s21_array.begin(), 20);
+  EXPECT_TRUE(s21::contains(s21_array, 9.0f));
+  const s21::array<float, 37> &const_array = s21_array;
+  EXPECT_EQ(s21::find(const_array, 0.5f), const_array.begin() + 36);
+}
+
+TEST(Algorithm, TestBitKernels) {
+  SimdLevelGuard guard;
+  std::mt19937_64 gen(5);
+  std::vector<std::uint64_t> a(37), b(37);
+  for (size_t i = 0; i < a.size(); ++i) {
+    a[i] = gen();
+    b[i] = gen();
+  }
+  size_t bits = 0;
+  for (std::uint64_t word : a) {
+    for (; word != 0; word &= word - 1) ++bits;
+  }
+  for (auto level : kLevels) {
+    s21::simd::force_level(level);
+    EXPECT_EQ(s21::simd::popcount(a.data(), a.data() + a.size()), bits);
+    std::vector<std::uint64_t> dst = a;
+    s21::simd::bitwise<s21::simd::bit_op::and_not_op>(dst.data(), b.data(),
+                                                      dst.size());
+    for (size_t i = 0; i < a.size(); ++i) EXPECT_EQ(dst[i], a[i] & ~b[i]);
+    s21::simd::bitwise<s21::simd::bit_op::xor_op>(dst.data(), b.data(),
+                                                  dst.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+      EXPECT_EQ(dst[i], (a[i] & ~b[i]) ^ b[i]);
+    }
+  }
+}
+
+TEST(Algorithm, TestNonArithmetic) {
+  s21::vector<std::string> s21_vector = {"b", "a", "c", "a"};
+  EXPECT_EQ(s21::count(s21_vector, std::string("a")), 2U);
+  EXPECT_EQ(s21::find(s21_vector, std::string("c")) - s21_vector.begin(), 2);
+  EXPECT_EQ(*s21::min_element(s21_vector), "a");
+  EXPECT_EQ(*s21::max_element(s21_vector), "c");
+}
+
+namespace {
+
+template <typename T>
+std::vector<T> RandomValues(size_t size, unsigned seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<T> values;
+  for (size_t i = 0; i < size; ++i) {
+    if constexpr (std::is_floating_point_v<T>) {
+      values.push_back(static_cast<T>(
+          std::uniform_real_distribution<double>(-1e6, 1e6)(gen)));
+    } else {
+      values.push_back(static_cast<T>(gen()));
+    }
+  }
+  return values;
+}
+
+template <typename T>
+void CheckSorts() {
+  for (size_t size : {0U, 1U, 2U, 15U, 33U, 100U, 1000U, 20000U}) {
+    std::vector<T> expected = RandomValues<T>(size, 7);
+    s21::vector<T> introsorted;
+    introsorted.append_range(expected);
+    s21::vector<T> stable = introsorted;
+    s21::vector<T> radix = introsorted;
+    std::sort(expected.begin(), expected.end());
+    s21::sort(introsorted);
+    s21::stable_sort(stable);
+    s21::radix_sort(radix);
+    for (size_t i = 0; i < size; ++i) {
+      ASSERT_EQ(introsorted[i], expected[i]);
+      ASSERT_EQ(stable[i], expected[i]);
+      ASSERT_EQ(radix[i], expected[i]);
+    }
+  }
+}
+
+struct Record {
+  int key;
+  int order;
+};
+
+}  // namespace
+
+TEST(AlgorithmSort, TestInt32) { CheckSorts<std::int32_t>(); }
+
+TEST(AlgorithmSort, TestUint64) { CheckSorts<std::uint64_t>(); }
+
+TEST(AlgorithmSort, TestInt8) { CheckSorts<std::int8_t>(); }
+
+TEST(AlgorithmSort, TestDouble) { CheckSorts<double>(); }
+
+TEST(AlgorithmSort, TestFloatSigns) {
+  s21::vector<float> s21_vector = {3.5f, -0.5f, 0.0f, -7.25f, 1e-3f, -1e9f};
+  s21::radix_sort(s21_vector);
+  std::vector<float> expected = {-1e9f, -7.25f, -0.5f, 0.0f, 1e-3f, 3.5f};
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], expected[i]);
+  }
+}
+
+TEST(AlgorithmSort, TestComparatorAndStrings) {
+  s21::vector<std::string> s21_vector;
+  for (int i = 0; i < 500; ++i) {
+    s21_vector.push_back(std::to_string((i * 7919) % 500));
+  }
+  s21::sort(s21_vector, std::greater<>());
+  EXPECT_TRUE(std::is_sorted(s21_vector.begin(), s21_vector.end(),
+                             std::greater<>()));
+  s21::stable_sort(s21_vector);
+  EXPECT_TRUE(std::is_sorted(s21_vector.begin(), s21_vector.end()));
+}
+
+TEST(AlgorithmSort, TestSortedAndEqualInputs) {
+  s21::vector<int> ascending;
+  s21::vector<int> equal(5000);
+  for (int i = 0; i < 5000; ++i) ascending.push_back(i);
+  s21::vector<int> descending = ascending;
+  std::reverse(descending.begin(), descending.end());
+  s21::sort(ascending);
+  s21::sort(descending);
+  s21::sort(equal);
+  for (int i = 0; i < 5000; ++i) {
+    ASSERT_EQ(ascending[static_cast<size_t>(i)], i);
+    ASSERT_EQ(descending[static_cast<size_t>(i)], i);
+    ASSERT_EQ(equal[static_cast<size_t>(i)], 0);
+  }
+}
+
+TEST(AlgorithmSort, TestStability) {
+  s21::vector<Record> by_stable_sort;
+  for (int i = 0; i < 3000; ++i) by_stable_sort.push_back({(i * 37) % 11, i});
+  s21::vector<Record> by_radix = by_stable_sort;
+  s21::stable_sort(by_stable_sort, [](const Record &a, const Record &b) {
+    return a.key < b.key;
+  });
+  s21::radix_sort(by_radix, [](const Record &r) { return r.key; });
+  for (size_t i = 1; i < by_stable_sort.size(); ++i) {
+    const Record &prev = by_stable_sort[i - 1];
+    const Record &cur = by_stable_sort[i];
+    ASSERT_TRUE(prev.key < cur.key ||
+                (prev.key == cur.key && prev.order < cur.order));
+    EXPECT_EQ(by_radix[i].key, cur.key);
+    EXPECT_EQ(by_radix[i].order, cur.order);
+  }
+}
+
+TEST(AlgorithmSearch, TestBounds) {
+  std::vector<int> std_vector = {1, 2, 2, 2, 5, 7, 7, 9, 12};
+  s21::vector<int> s21_vector = {1, 2, 2, 2, 5, 7, 7, 9, 12};
+  for (int value = 0; value <= 13; ++value) {
+    EXPECT_EQ(s21::lower_bound(s21_vector, value) - s21_vector.begin(),
+              std::lower_bound(std_vector.begin(), std_vector.end(), value) -
+                  std_vector.begin());
+    EXPECT_EQ(s21::upper_bound(s21_vector, value) - s21_vector.begin(),
+              std::upper_bound(std_vector.begin(), std_vector.end(), value) -
+                  std_vector.begin());
+  }
+  s21::vector<int> empty;
+  EXPECT_EQ(s21::lower_bound(empty, 3), empty.end());
+  EXPECT_EQ(s21::upper_bound(empty, 3), empty.end());
+}
+
+TEST(AlgorithmSearch, TestBoundsAllSizes) {
+  for (int size = 1; size < 70; ++size) {
+    s21::vector<int> s21_vector;
+    for (int i = 0; i < size; ++i) s21_vector.push_back(2 * i);
+    for (int value = -1; value <= 2 * size; ++value) {
+      auto lower = s21::lower_bound(s21_vector, value);
+      auto upper = s21::upper_bound(s21_vector, value, std::less<>());
+      EXPECT_EQ(lower - s21_vector.begin(), (value + 1) / 2);
+      EXPECT_EQ(upper - s21_vector.begin(),
+                value < 0 ? 0 : std::min(size, value / 2 + 1));
+    }
+  }
+}
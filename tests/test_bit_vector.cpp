@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../s21_containers.h"
+
+namespace {
+
+std::vector<bool> RandomBits(size_t size, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::vector<bool> bits(size);
+  for (size_t i = 0; i < size; ++i) bits[i] = gen() % 3 == 0;
+  return bits;
+}
+
+s21::bit_vector FromBits(const std::vector<bool> &bits) {
+  s21::bit_vector result;
+  for (bool bit : bits) result.push_back(bit);
+  return result;
+}
+
+}  // namespace
+
+TEST(BitVector, TestPushBackAndAccess) {
+  s21::bit_vector v{true, false, true};
+  v.insert_many_back(false, true);
+  ASSERT_EQ(v.size(), 5U);
+  ASSERT_TRUE(v[0]);
+  ASSERT_FALSE(v[1]);
+  ASSERT_TRUE(v.back());
+  v[1] = true;
+  v.flip(0);
+  v.reset(4);
+  ASSERT_FALSE(v.at(0));
+  ASSERT_TRUE(v.at(1));
+  ASSERT_THROW(v.at(5), std::out_of_range);
+  v.pop_back();
+  ASSERT_EQ(v.size(), 4U);
+  ASSERT_EQ(v.count(), 2U);
+  ASSERT_EQ(v.word_count(), 1U);
+}
+
+TEST(BitVector, TestResizeKeepsTailClear) {
+  s21::bit_vector v(70, true);
+  ASSERT_EQ(v.count(), 70U);
+  ASSERT_TRUE(v.all());
+  v.resize(65);
+  ASSERT_EQ(v.count(), 65U);
+  v.resize(130);
+  ASSERT_EQ(v.count(), 65U);
+  v.resize(200, true);
+  ASSERT_EQ(v.count(), 135U);
+  ASSERT_FALSE(v[64 + 1]);
+  ASSERT_TRUE(v[199]);
+  for (int i = 0; i < 200; ++i) v.pop_back();
+  ASSERT_TRUE(v.empty());
+  ASSERT_EQ(v.word_count(), 0U);
+  ASSERT_EQ(v.find_first(), s21::bit_vector::npos);
+}
+
+TEST(BitVector, TestCountAndFind) {
+  for (size_t size : {0U, 1U, 63U, 64U, 65U, 1000U, 4099U}) {
+    std::vector<bool> bits = RandomBits(size, 1);
+    s21::bit_vector v = FromBits(bits);
+    size_t expected = 0;
+    for (bool bit : bits) expected += bit;
+    ASSERT_EQ(v.count(), expected);
+    std::vector<size_t> positions;
+    for (size_t i = v.find_first(); i != s21::bit_vector::npos;
+         i = v.find_next(i)) {
+      positions.push_back(i);
+    }
+    ASSERT_EQ(positions.size(), expected);
+    for (size_t pos : positions) ASSERT_TRUE(bits[pos]);
+    ASSERT_EQ(v.any(), expected > 0);
+  }
+}
+
+TEST(BitVector, TestBulkOperations) {
+  for (size_t size : {5U, 64U, 1000U, 4099U}) {
+    std::vector<bool> a = RandomBits(size, 2);
+    std::vector<bool> b = RandomBits(size, 3);
+    s21::bit_vector va = FromBits(a);
+    s21::bit_vector vb = FromBits(b);
+    s21::bit_vector and_bits = va & vb;
+    s21::bit_vector or_bits = va | vb;
+    s21::bit_vector xor_bits = va ^ vb;
+    s21::bit_vector and_not_bits = va;
+    and_not_bits.and_not(vb);
+    for (size_t i = 0; i < size; ++i) {
+      ASSERT_EQ(and_bits[i], a[i] && b[i]);
+      ASSERT_EQ(or_bits[i], a[i] || b[i]);
+      ASSERT_EQ(xor_bits[i], a[i] != b[i]);
+      ASSERT_EQ(and_not_bits[i], a[i] && !b[i]);
+    }
+    ASSERT_TRUE((xor_bits ^ vb) == va);
+    ASSERT_TRUE(and_bits != or_bits || and_bits.count() == or_bits.count());
+  }
+  s21::bit_vector small(3);
+  s21::bit_vector big(4);
+  ASSERT_THROW(small &= big, std::length_error);
+}
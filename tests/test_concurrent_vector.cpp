@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+
+namespace {
+
+struct ThrowOnSeven {
+  explicit ThrowOnSeven(int v) : value(v) {
+    if (v == 7) throw std::runtime_error("seven");
+  }
+  int value;
+};
+
+}  // namespace
+
+TEST(ConcurrentVector, TestSequential) {
+  s21::concurrent_vector<std::string> v{"a", "b"};
+  std::string &first = v[0];
+  for (int i = 0; i < 1000; ++i) v.push_back(std::to_string(i));
+  ASSERT_EQ(&first, &v[0]);
+  ASSERT_EQ(v.size(), 1002U);
+  ASSERT_EQ(v.at(1001), "999");
+  ASSERT_THROW(v.at(1002), std::out_of_range);
+  ASSERT_GE(v.capacity(), v.size());
+  size_t count = 0;
+  for (const auto &item : v) count += item.empty() ? 0U : 1U;
+  ASSERT_EQ(count, 1002U);
+  v.clear();
+  ASSERT_TRUE(v.empty());
+  v.emplace_back(3U, 'x');
+  ASSERT_EQ(v[0], "xxx");
+}
+
+TEST(ConcurrentVector, TestGrowBy) {
+  s21::concurrent_vector<int> v;
+  v.reserve(100);
+  ASSERT_GE(v.capacity(), 100U);
+  ASSERT_EQ(v.grow_by(40), 0U);
+  ASSERT_EQ(v.grow_by(60, 5), 40U);
+  ASSERT_EQ(v.size(), 100U);
+  ASSERT_EQ(v[39], 0);
+  ASSERT_EQ(v[99], 5);
+}
+
+TEST(ConcurrentVector, TestParallelPushBack) {
+  constexpr int kThreads = 8;
+  constexpr int kPerThread = 20000;
+  s21::concurrent_vector<int> v;
+  std::vector<std::thread> threads;
+  std::vector<const int *> addresses(kThreads);
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&v, &addresses, t] {
+      addresses[size_t(t)] = &v.push_back(t * kPerThread);
+      for (int i = 1; i < kPerThread; ++i) {
+        if (i % 100 == 0) {
+          v.grow_by(1, t * kPerThread + i);
+        } else {
+          v.push_back(t * kPerThread + i);
+        }
+        size_t published = v.size();
+        if (published > 0) {
+          ASSERT_GE(v[published - 1], 0);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  ASSERT_EQ(v.size(), size_t(kThreads * kPerThread));
+  std::vector<int> values(v.begin(), v.end());
+  std::sort(values.begin(), values.end());
+  for (int i = 0; i < kThreads * kPerThread; ++i) {
+    ASSERT_EQ(values[size_t(i)], i);
+  }
+  for (int t = 0; t < kThreads; ++t) {
+    ASSERT_EQ(*addresses[size_t(t)], t * kPerThread);
+  }
+}
+
+TEST(ConcurrentVector, TestThrowingConstructor) {
+  s21::concurrent_vector<ThrowOnSeven> v;
+  for (int i = 0; i < 10; ++i) {
+    if (i == 7) {
+      ASSERT_THROW(v.emplace_back(i), std::runtime_error);
+    } else {
+      v.emplace_back(i);
+    }
+  }
+  ASSERT_EQ(v.size(), 10U);
+  ASSERT_THROW(v.at(7), std::out_of_range);
+  ASSERT_EQ(v.at(8).value, 8);
+  int count = 0;
+  for (const auto &item : v) count += item.value != 7;
+  ASSERT_EQ(count, 9);
+}
+
+TEST(ConcurrentVector, TestFailedClaimDoesNotStall) {
+  s21::concurrent_vector<int> v;
+  v.push_back(1);
+  EXPECT_THROW(v.grow_by(v.max_size()), std::out_of_range);
+  EXPECT_EQ(v.size(), 1U);
+  v.push_back(2);
+  v.grow_by(40, 3);
+  EXPECT_EQ(v.size(), 42U);
+  EXPECT_EQ(v[1], 2);
+  EXPECT_EQ(v.at(41), 3);
+  v.clear();
+  EXPECT_TRUE(v.empty());
+}
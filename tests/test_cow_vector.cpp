@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+
+TEST(CowVector, TestCopiesShareBuffer) {
+  s21::cow_vector<std::string> a{"x", "y", "z"};
+  ASSERT_EQ(a.use_count(), 1U);
+  s21::cow_vector<std::string> b = a;
+  const s21::cow_vector<std::string> &cb = b;
+  ASSERT_EQ(a.use_count(), 2U);
+  const s21::cow_vector<std::string> &ca = a;
+  ASSERT_EQ(cb.data(), ca.data());
+  ASSERT_EQ(cb[1], "y");
+  ASSERT_EQ(cb.at(2), "z");
+  ASSERT_EQ(a.use_count(), 2U);
+
+  b.push_back("w");
+  ASSERT_EQ(a.use_count(), 1U);
+  ASSERT_EQ(b.use_count(), 1U);
+  ASSERT_EQ(a.size(), 3U);
+  ASSERT_EQ(b.size(), 4U);
+  ASSERT_EQ(b.back(), "w");
+}
+
+TEST(CowVector, TestMutatorsDetach) {
+  s21::cow_vector<int> a{1, 2, 3, 4};
+  s21::cow_vector<int> b = a;
+  b[0] = 10;
+  ASSERT_EQ(a[0], 1);
+  s21::cow_vector<int> c = a;
+  const s21::cow_vector<int> &ca = a;
+  c.insert(ca.begin() + 1, 7);
+  ASSERT_EQ(c[1], 7);
+  ASSERT_EQ(a.size(), 4U);
+  s21::cow_vector<int> d = a;
+  d.erase(ca.begin(), ca.begin() + 2);
+  ASSERT_EQ(d.size(), 2U);
+  ASSERT_EQ(d.front(), 3);
+  ASSERT_EQ(a.front(), 1);
+  s21::cow_vector<int> e = a;
+  e.erase(ca.begin() + 3);
+  e.resize(5, 9);
+  e.pop_back();
+  e.insert_many_back(5, 6);
+  ASSERT_EQ(e.size(), 6U);
+  ASSERT_EQ(e[3], 9);
+  ASSERT_EQ(a.size(), 4U);
+  ASSERT_THROW(e.erase(ca.begin()), std::out_of_range);
+  ASSERT_THROW(e.at(6), std::out_of_range);
+}
+
+TEST(CowVector, TestClearAndAssign) {
+  s21::cow_vector<int> a{1, 2, 3};
+  s21::cow_vector<int> b = a;
+  b.clear();
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(a.size(), 3U);
+  ASSERT_EQ(a.use_count(), 1U);
+  b = a;
+  ASSERT_EQ(a.use_count(), 2U);
+  b = s21::cow_vector<int>(s21::vector<int>{4, 5});
+  ASSERT_EQ(a.use_count(), 1U);
+  ASSERT_EQ(b[1], 5);
+  s21::cow_vector<int> c(std::move(b));
+  ASSERT_EQ(b.use_count(), 0U);
+  ASSERT_EQ(c.size(), 2U);
+  c.reserve(100);
+  ASSERT_GE(c.capacity(), 100U);
+}
+
+TEST(CowVector, TestSnapshotsAcrossThreads) {
+  s21::cow_vector<int> table;
+  for (int i = 0; i < 1000; ++i) table.push_back(i);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < 4; ++t) {
+    workers.emplace_back([snapshot = table, t]() mutable {
+      long sum = 0;
+      const auto &view = snapshot;
+      for (int value : view) sum += value;
+      EXPECT_EQ(sum, 499500);
+      snapshot.push_back(t);
+      EXPECT_EQ(snapshot.size(), 1001U);
+    });
+  }
+  for (auto &worker : workers) worker.join();
+  ASSERT_EQ(table.size(), 1000U);
+  ASSERT_TRUE(table.unique());
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+
+namespace {
+
+struct Task {
+  explicit Task(int task_id)
+      : id(task_id),
+        name(std::to_string(task_id)),
+        queue_hook(),
+        owner_hook() {}
+
+  int id;
+  std::string name;
+  s21::list_hook queue_hook;
+  s21::list_hook owner_hook;
+};
+
+using TaskQueue = s21::intrusive_list<Task, &Task::queue_hook>;
+using OwnerList = s21::intrusive_list<Task, &Task::owner_hook>;
+
+std::vector<int> Ids(const TaskQueue &list) {
+  std::vector<int> ids;
+  for (const Task &task : list) ids.push_back(task.id);
+  return ids;
+}
+
+}  // namespace
+
+TEST(IntrusiveList, TestPushAndIterate) {
+  Task a(1), b(2), c(3);
+  TaskQueue queue;
+  EXPECT_TRUE(queue.empty());
+  queue.push_back(b);
+  queue.push_back(c);
+  queue.push_front(a);
+  EXPECT_EQ(queue.size(), 3U);
+  EXPECT_EQ(Ids(queue), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(&queue.front(), &a);
+  EXPECT_EQ(queue.back().name, "3");
+  auto it = queue.end();
+  EXPECT_EQ((--it)->id, 3);
+  EXPECT_THROW(queue.push_back(a), std::logic_error);
+}
+
+TEST(IntrusiveList, TestUnlinkByObject) {
+  Task a(1), b(2), c(3);
+  TaskQueue queue;
+  queue.push_back(a);
+  queue.push_back(b);
+  queue.push_back(c);
+  TaskQueue::remove(b);
+  EXPECT_FALSE(b.queue_hook.is_linked());
+  EXPECT_EQ(Ids(queue), (std::vector<int>{1, 3}));
+  auto next = queue.erase(TaskQueue::iterator_to(a));
+  EXPECT_EQ(&*next, &c);
+  queue.insert(next, b);
+  EXPECT_EQ(Ids(queue), (std::vector<int>{2, 3}));
+  queue.pop_back();
+  queue.pop_front();
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(IntrusiveList, TestAutoUnlink) {
+  TaskQueue queue;
+  Task a(1);
+  queue.push_back(a);
+  {
+    Task b(2);
+    queue.push_back(b);
+    auto c = std::make_unique<Task>(3);
+    queue.push_front(*c);
+    EXPECT_EQ(queue.size(), 3U);
+  }
+  EXPECT_EQ(Ids(queue), (std::vector<int>{1}));
+  {
+    TaskQueue temporary;
+    Task d(4);
+    temporary.push_back(d);
+    TaskQueue::remove(d);
+    temporary.push_back(d);
+  }
+  Task copy = a;
+  EXPECT_FALSE(copy.queue_hook.is_linked());
+  EXPECT_EQ(queue.size(), 1U);
+}
+
+TEST(IntrusiveList, TestSplice) {
+  Task a(1), b(2), c(3), d(4), e(5);
+  TaskQueue first, second;
+  first.push_back(a);
+  first.push_back(b);
+  second.push_back(c);
+  second.push_back(d);
+  second.push_back(e);
+  first.splice(TaskQueue::iterator_to(b), second,
+               TaskQueue::iterator_to(d));
+  EXPECT_EQ(Ids(first), (std::vector<int>{1, 4, 2}));
+  EXPECT_EQ(Ids(second), (std::vector<int>{3, 5}));
+  first.splice(first.begin(), second);
+  EXPECT_TRUE(second.empty());
+  EXPECT_EQ(Ids(first), (std::vector<int>{3, 5, 1, 4, 2}));
+  second.splice(second.end(), first, TaskQueue::iterator_to(a),
+                first.end());
+  EXPECT_EQ(Ids(first), (std::vector<int>{3, 5}));
+  EXPECT_EQ(Ids(second), (std::vector<int>{1, 4, 2}));
+  first.swap(second);
+  EXPECT_EQ(Ids(first), (std::vector<int>{1, 4, 2}));
+  TaskQueue moved = std::move(first);
+  EXPECT_TRUE(first.empty());
+  EXPECT_EQ(Ids(moved), (std::vector<int>{1, 4, 2}));
+}
+
+TEST(IntrusiveList, TestSeveralHooks) {
+  Task a(1), b(2);
+  TaskQueue queue;
+  OwnerList owned;
+  queue.push_back(a);
+  queue.push_back(b);
+  owned.push_back(b);
+  owned.push_back(a);
+  EXPECT_EQ(owned.front().id, 2);
+  queue.clear();
+  EXPECT_FALSE(a.queue_hook.is_linked());
+  EXPECT_TRUE(a.owner_hook.is_linked());
+  EXPECT_EQ(owned.size(), 2U);
+}
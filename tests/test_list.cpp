@@ -1,9 +1,25 @@
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <list>
+#include <string>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "../s21_containers.h"
 
+template <typename T>
+bool SameElements(s21::list<T>& s21_list, const std::list<T>& std_list) {
+  if (s21_list.size() != std_list.size()) return false;
+  auto it = std_list.begin();
+  for (const T& value : s21_list) {
+    if (!(value == *it++)) return false;
+  }
+  return true;
+}
+
 TEST(List, ConstructorDefault) {
   s21::list<int> s21_list;
   std::list<int> std_list;
@@ -166,6 +182,37 @@ TEST(List, ModifierMerge) {
   EXPECT_EQ(s21_list_1.size(), std_list_1.size());
 }
 
+TEST(List, ModifierMergeRelinksNodes) {
+  s21::list<std::pair<int, int>> s21_list_1 = {{1, 1}, {3, 1}, {3, 1}, {9, 1}};
+  s21::list<std::pair<int, int>> s21_list_2 = {{0, 2}, {3, 2}, {4, 2}};
+  std::list<std::pair<int, int>> std_list_1 = {{1, 1}, {3, 1}, {3, 1}, {9, 1}};
+  std::list<std::pair<int, int>> std_list_2 = {{0, 2}, {3, 2}, {4, 2}};
+  auto by_key = [](const std::pair<int, int>& a,
+                   const std::pair<int, int>& b) { return a.first < b.first; };
+  const void* moved = s21_list_2.begin().getNode();
+  s21_list_1.merge(s21_list_2, by_key);
+  std_list_1.merge(std_list_2, by_key);
+  EXPECT_TRUE(SameElements(s21_list_1, std_list_1));
+  EXPECT_TRUE(s21_list_2.empty());
+  EXPECT_EQ(s21_list_1.begin().getNode(), moved);
+  while (!std_list_1.empty()) {
+    ASSERT_EQ(s21_list_1.back(), std_list_1.back());
+    s21_list_1.pop_back();
+    std_list_1.pop_back();
+  }
+}
+
+TEST(List, ModifierMergeIntoEmpty) {
+  s21::list<int> s21_list_1;
+  s21::list<int> s21_list_2 = {5, 3, 1};
+  s21_list_1.merge(s21_list_2, std::greater<int>());
+  EXPECT_EQ(s21_list_1.size(), 3U);
+  EXPECT_EQ(s21_list_1.front(), 5);
+  EXPECT_EQ(s21_list_1.back(), 1);
+  s21_list_1.merge(s21_list_1);
+  EXPECT_EQ(s21_list_1.size(), 3U);
+}
+
 TEST(List, ModifierReverse) {
   s21::list<int> s21_list_1 = {1, 2, 3, 4};
   s21::list<int> s21_list_2 = {4, 3, 2, 1};
@@ -206,6 +253,54 @@ TEST(List, ModifierSort) {
   }
 }
 
+TEST(List, ModifierSortComparator) {
+  s21::list<int> s21_list{3, 1, 4, 1, 5, 9, 2, 6};
+  std::list<int> std_list{3, 1, 4, 1, 5, 9, 2, 6};
+  s21_list.sort(std::greater<int>());
+  std_list.sort(std::greater<int>());
+  EXPECT_TRUE(SameElements(s21_list, std_list));
+}
+
+TEST(List, ModifierSortStableAndLarge) {
+  s21::list<std::pair<int, int>> s21_list;
+  std::list<std::pair<int, int>> std_list;
+  unsigned seed = 12345;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245U + 12345U;
+    std::pair<int, int> item(static_cast<int>((seed >> 16) % 100U), i);
+    s21_list.push_back(item);
+    std_list.push_back(item);
+  }
+  auto by_key = [](const std::pair<int, int>& a,
+                   const std::pair<int, int>& b) { return a.first < b.first; };
+  s21_list.sort(by_key);
+  std_list.sort(by_key);
+  EXPECT_TRUE(SameElements(s21_list, std_list));
+  while (!std_list.empty()) {
+    ASSERT_EQ(s21_list.back(), std_list.back());
+    s21_list.pop_back();
+    std_list.pop_back();
+  }
+  EXPECT_TRUE(s21_list.empty());
+}
+
+TEST(List, ModifierSortThrowingComparator) {
+  s21::list<int> s21_list{5, 4, 3, 2, 1, 0, 9, 8, 7, 6};
+  int calls = 0;
+  auto comp = [&calls](int a, int b) {
+    if (++calls == 12) throw std::runtime_error("comparator");
+    return a < b;
+  };
+  EXPECT_THROW(s21_list.sort(comp), std::runtime_error);
+  EXPECT_EQ(s21_list.size(), 10U);
+  int sum = 0;
+  for (int value : s21_list) sum += value;
+  EXPECT_EQ(sum, 45);
+  s21_list.sort();
+  EXPECT_EQ(s21_list.front(), 0);
+  EXPECT_EQ(s21_list.back(), 9);
+}
+
 TEST(List, ModifierSplice) {
   s21::list<int> s21_list1{1, -1, -23, 4, 1, 5, 6, 4, -1, -1};
   std::list<int> std_list1{1, -1, -23, 4, 1, 5, 6, 4, -1, -1};
@@ -352,4 +447,95 @@ TEST(ListModifiers, TestInsertManySingleElement) {
     ++s21_it;
     ++std_it;
   }
-}
\ No newline at end of file
+}
+TEST(ListPool, TestReserveAvoidsNewChunks) {
+  s21::node_pool<s21::list<int>::Node> pool;
+  pool.reserve(1000);
+  size_t chunks = pool.chunk_count();
+  ASSERT_GE(pool.available(), 1000U);
+  std::vector<s21::list<int>::Node*> nodes;
+  for (int i = 0; i < 1000; ++i) nodes.push_back(pool.allocate());
+  EXPECT_EQ(pool.chunk_count(), chunks);
+  for (auto* node : nodes) pool.deallocate(node);
+  EXPECT_GE(pool.available(), 1000U);
+  auto* again = pool.allocate();
+  EXPECT_EQ(again, nodes.back());
+  pool.deallocate(again);
+}
+
+TEST(ListPool, TestNodesOutliveTheirPool) {
+  s21::node_pool<s21::list<int>::Node> other;
+  auto* pool = new s21::node_pool<s21::list<int>::Node>();
+  auto* node = pool->allocate();
+  delete pool;
+  other.deallocate(node);
+  EXPECT_EQ(other.available(), 0U);
+}
+
+TEST(ListPool, TestReserveAndChurn) {
+  s21::list<std::string> list;
+  list.reserve(100);
+  for (int round = 0; round < 50; ++round) {
+    for (int i = 0; i < 100; ++i) list.push_back(std::to_string(i));
+    for (int i = 0; i < 100; ++i) list.pop_front();
+  }
+  EXPECT_TRUE(list.empty());
+  list.push_front("x");
+  list.insert(list.begin(), "y");
+  EXPECT_EQ(list.front(), "y");
+}
+
+TEST(ListPool, TestSplicedNodesSurviveDonor) {
+  s21::list<std::string> target = {"a", "b"};
+  {
+    s21::list<std::string> donor = {"c", "d", "e"};
+    target.splice(target.cend(), donor);
+    donor.push_back("f");
+    s21::list<std::string> sorted = {"0", "z"};
+    target.merge(sorted);
+  }
+  EXPECT_EQ(target.size(), 7U);
+  target.sort();
+  EXPECT_EQ(target.front(), "0");
+  EXPECT_EQ(target.back(), "z");
+  s21::list<std::string> moved = std::move(target);
+  s21::list<std::string> swapped;
+  swapped.swap(moved);
+  while (!swapped.empty()) swapped.pop_back();
+  swapped.push_back("g");
+  EXPECT_EQ(swapped.size(), 1U);
+}
+
+TEST(ListPool, TestChunksStartSmall) {
+  using Pool = s21::node_pool<s21::list<int>::Node>;
+  Pool pool;
+  auto *node = pool.allocate();
+  EXPECT_EQ(pool.chunk_count(), 1U);
+  EXPECT_EQ(pool.available(), Pool::first_chunk_nodes - 1);
+  std::vector<s21::list<int>::Node *> nodes{node};
+  while (pool.chunk_count() < 4) nodes.push_back(pool.allocate());
+  EXPECT_EQ(nodes.size(), 7 * Pool::first_chunk_nodes + 1);
+  for (auto *n : nodes) pool.deallocate(n);
+}
+
+TEST(ListPool, TestHandOffToAnotherThread) {
+  s21::list<int> consumed;
+  std::thread consumer;
+  {
+    s21::list<int> batch;
+    for (int round = 0; round < 20; ++round) {
+      for (int i = 0; i < 500; ++i) batch.push_back(i);
+      s21::list<int> handed;
+      handed.splice(handed.cend(), batch);
+      if (consumer.joinable()) consumer.join();
+      consumer = std::thread([&consumed, moved = std::move(handed)]() mutable {
+        consumed.splice(consumed.cend(), moved);
+        while (consumed.size() > 100) consumed.pop_front();
+      });
+      for (int i = 0; i < 500; ++i) batch.push_back(i);
+      batch.clear();
+    }
+  }
+  consumer.join();
+  EXPECT_EQ(consumed.size(), 100U);
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include "../s21_containers.h"
+
+namespace {
+
+struct Point {
+  std::int32_t x;
+  std::int32_t y;
+};
+
+class TempFile {
+ public:
+  explicit TempFile(const std::string &name)
+      : path_(testing::TempDir() + "s21_" + name + "_" +
+              std::to_string(::getpid())) {
+    std::remove(path_.c_str());
+  }
+  ~TempFile() { std::remove(path_.c_str()); }
+  TempFile(const TempFile &) = delete;
+  TempFile &operator=(const TempFile &) = delete;
+
+  const std::string &path() const { return path_; }
+
+ private:
+  std::string path_;
+};
+
+}  // namespace
+
+TEST(MmapVector, TestCreateAndReopen) {
+  TempFile file("reopen");
+  {
+    s21::mmap_vector<std::uint64_t> v(file.path());
+    ASSERT_TRUE(v.empty());
+    for (std::uint64_t i = 0; i < 10000; ++i) v.push_back(i * i);
+    ASSERT_EQ(v.size(), 10000U);
+    ASSERT_GE(v.capacity(), 10000U);
+    v.sync();
+  }
+  s21::mmap_vector<std::uint64_t> v(file.path());
+  ASSERT_EQ(v.size(), 10000U);
+  for (std::uint64_t i = 0; i < 10000; ++i) ASSERT_EQ(v[i], i * i);
+  v.push_back(1);
+  ASSERT_EQ(v.back(), 1U);
+}
+
+TEST(MmapVector, TestModifiers) {
+  TempFile file("modifiers");
+  s21::mmap_vector<Point> v(file.path());
+  v.insert_many_back(Point{1, 1}, Point{2, 2}, Point{4, 4});
+  auto it = v.insert(v.cbegin() + 2, Point{3, 3});
+  ASSERT_EQ(it->x, 3);
+  v.emplace_back(Point{5, 5});
+  for (int i = 0; i < 5; ++i) ASSERT_EQ(v.at(size_t(i)).y, i + 1);
+  v.erase(v.cbegin());
+  v.erase(v.cbegin() + 1, v.cbegin() + 3);
+  ASSERT_EQ(v.size(), 2U);
+  ASSERT_EQ(v.front().x, 2);
+  ASSERT_EQ(v.back().x, 5);
+  v.resize(4, Point{7, 7});
+  ASSERT_EQ(v[3].y, 7);
+  v.pop_back();
+  v.shrink_to_fit();
+  ASSERT_EQ(v.capacity(), 3U);
+  v.clear();
+  ASSERT_TRUE(v.empty());
+  ASSERT_THROW(v.at(0), std::out_of_range);
+  ASSERT_THROW(v.erase(v.cbegin()), std::out_of_range);
+}
+
+TEST(MmapVector, TestSelfReferencingPushBack) {
+  TempFile file("alias");
+  s21::mmap_vector<int> v(file.path());
+  v.push_back(42);
+  for (int i = 0; i < 20; ++i) v.push_back(v[0]);
+  for (int value : v) ASSERT_EQ(value, 42);
+}
+
+TEST(MmapVector, TestReadOnly) {
+  TempFile file("read_only");
+  ASSERT_THROW(
+      s21::mmap_vector<int>(file.path(), s21::mmap_mode::read_only),
+      std::system_error);
+  {
+    s21::mmap_vector<int> v(file.path());
+    v.insert_many_back(1, 2, 3);
+  }
+  const s21::mmap_vector<int> v(file.path(), s21::mmap_mode::read_only);
+  ASSERT_TRUE(v.read_only());
+  ASSERT_EQ(v.size(), 3U);
+  ASSERT_EQ(v[2], 3);
+  s21::mmap_vector<int> w(file.path(), s21::mmap_mode::read_only);
+  ASSERT_THROW(w.push_back(4), std::logic_error);
+  ASSERT_THROW(w.clear(), std::logic_error);
+  ASSERT_EQ(w.size(), 3U);
+}
+
+TEST(MmapVector, TestTypeMismatch) {
+  TempFile file("mismatch");
+  { s21::mmap_vector<std::int32_t> v(file.path()); }
+  ASSERT_THROW(s21::mmap_vector<std::uint32_t>{file.path()},
+               std::runtime_error);
+  ASSERT_THROW(s21::mmap_vector<std::int64_t>{file.path()},
+               std::runtime_error);
+  ASSERT_NO_THROW(s21::mmap_vector<std::int32_t>{file.path()});
+}
+
+TEST(MmapVector, TestMoveAndSwap) {
+  TempFile first("first");
+  TempFile second("second");
+  s21::mmap_vector<int> a(first.path());
+  s21::mmap_vector<int> b(second.path());
+  a.push_back(1);
+  b.insert_many_back(2, 3);
+  a.swap(b);
+  ASSERT_EQ(a.size(), 2U);
+  ASSERT_EQ(a.path(), second.path());
+  s21::mmap_vector<int> c(std::move(a));
+  ASSERT_EQ(c[1], 3);
+  ASSERT_EQ(a.size(), 0U);
+  a.clear();
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(a.capacity(), 0U);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+
+namespace {
+
+s21::vector<std::int64_t> RandomInts(size_t size, std::int64_t range) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<std::int64_t> dist(-range, range);
+  s21::vector<std::int64_t> result;
+  result.reserve(size);
+  for (size_t i = 0; i < size; ++i) result.push_back(dist(gen));
+  return result;
+}
+
+}  // namespace
+
+TEST(ThreadPool, TestTaskGroup) {
+  s21::thread_pool pool(4);
+  std::atomic<int> sum(0);
+  s21::task_group group(pool);
+  for (int i = 1; i <= 100; ++i) group.run([&sum, i] { sum += i; });
+  group.wait();
+  ASSERT_EQ(sum, 5050);
+  ASSERT_EQ(pool.size(), 4U);
+}
+
+TEST(ThreadPool, TestNestedGroups) {
+  s21::thread_pool pool(2);
+  std::atomic<int> leaves(0);
+  s21::task_group outer(pool);
+  for (int i = 0; i < 8; ++i) {
+    outer.run([&pool, &leaves] {
+      s21::task_group inner(pool);
+      for (int j = 0; j < 8; ++j) inner.run([&leaves] { ++leaves; });
+      inner.wait();
+    });
+  }
+  outer.wait();
+  ASSERT_EQ(leaves, 64);
+}
+
+TEST(ThreadPool, TestException) {
+  s21::task_group group;
+  group.run([] { throw std::runtime_error("task failed"); });
+  group.run([] {});
+  ASSERT_THROW(group.wait(), std::runtime_error);
+  group.run([] {});
+  ASSERT_NO_THROW(group.wait());
+}
+
+TEST(Parallel, TestSort) {
+  for (size_t size : {0U, 1U, 1000U, 40000U, 300001U}) {
+    s21::vector<std::int64_t> values = RandomInts(size, 1000);
+    std::vector<std::int64_t> expected(values.begin(), values.end());
+    std::sort(expected.begin(), expected.end());
+    s21::parallel::sort(values);
+    ASSERT_TRUE(std::equal(values.begin(), values.end(), expected.begin()));
+  }
+}
+
+TEST(Parallel, TestSortComparatorAndStrings) {
+  s21::vector<std::string> values;
+  std::vector<std::string> expected;
+  for (std::int64_t value : RandomInts(100000, 1 << 20)) {
+    values.push_back(std::to_string(value));
+    expected.push_back(values.back());
+  }
+  std::sort(expected.begin(), expected.end(), std::greater<>());
+  s21::parallel::sort(values, std::greater<>());
+  ASSERT_TRUE(std::equal(values.begin(), values.end(), expected.begin()));
+}
+
+TEST(Parallel, TestForEachAndTransform) {
+  s21::vector<std::int64_t> values = RandomInts(200000, 1 << 20);
+  s21::vector<std::int64_t> doubled(values.size());
+  s21::parallel::transform(values, doubled,
+                           [](std::int64_t x) { return 2 * x; });
+  s21::parallel::for_each(values, [](std::int64_t &x) { x *= 2; });
+  ASSERT_TRUE(s21::equal(values, doubled));
+}
+
+TEST(Parallel, TestReduce) {
+  for (size_t size : {0U, 5U, 200000U}) {
+    s21::vector<std::int64_t> values = RandomInts(size, 1 << 20);
+    std::int64_t expected =
+        std::accumulate(values.begin(), values.end(), std::int64_t{10});
+    ASSERT_EQ(s21::parallel::reduce(values, std::int64_t{10}), expected);
+  }
+  s21::vector<std::int64_t> values = RandomInts(100000, 1 << 20);
+  ASSERT_EQ(s21::parallel::reduce(values, std::int64_t{-(1 << 21)},
+                                  [](std::int64_t a, std::int64_t b) {
+                                    return std::max(a, b);
+                                  }),
+            *std::max_element(values.begin(), values.end()));
+}
+
+TEST(Parallel, TestReduceOrder) {
+  // Concatenation is associative but not commutative.
+  s21::vector<std::string> values(50000);
+  for (size_t i = 0; i < values.size(); ++i) values[i] = char('a' + i % 26);
+  std::string expected =
+      std::accumulate(values.begin(), values.end(), std::string(">"));
+  ASSERT_EQ(s21::parallel::reduce(values, std::string(">")), expected);
+}
+
+TEST(Parallel, TestInclusiveScan) {
+  for (size_t size : {0U, 3U, 32768U, 250000U}) {
+    s21::vector<std::int64_t> values = RandomInts(size, 1000);
+    s21::vector<std::int64_t> result(size);
+    std::vector<std::int64_t> expected(size);
+    std::partial_sum(values.begin(), values.end(), expected.begin());
+    s21::parallel::inclusive_scan(values, result);
+    ASSERT_TRUE(std::equal(result.begin(), result.end(), expected.begin()));
+  }
+}
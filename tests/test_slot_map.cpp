@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+
+TEST(SlotMap, TestInsertAndLookup) {
+  s21::slot_map<std::string> map;
+  auto a = map.insert("a");
+  auto b = map.emplace(3U, 'b');
+  ASSERT_EQ(map.size(), 2U);
+  ASSERT_NE(a, b);
+  ASSERT_TRUE(map.contains(a));
+  ASSERT_EQ(map[a], "a");
+  ASSERT_EQ(map.at(b), "bbb");
+  ASSERT_EQ(*map.find(b), "bbb");
+  ASSERT_EQ(map.find(decltype(a)()), nullptr);
+  ASSERT_THROW(map.at(decltype(a)()), std::out_of_range);
+}
+
+TEST(SlotMap, TestEraseKeepsOtherHandles) {
+  s21::slot_map<int> map;
+  std::vector<s21::slot_map<int>::handle> handles;
+  for (int i = 0; i < 100; ++i) handles.push_back(map.insert(i));
+  for (int i = 0; i < 100; i += 3) {
+    ASSERT_TRUE(map.erase(handles[static_cast<size_t>(i)]));
+  }
+  ASSERT_EQ(map.size(), 66U);
+  for (int i = 0; i < 100; ++i) {
+    const auto &h = handles[static_cast<size_t>(i)];
+    if (i % 3 == 0) {
+      ASSERT_FALSE(map.contains(h));
+      ASSERT_FALSE(map.erase(h));
+    } else {
+      ASSERT_EQ(map.at(h), i);
+    }
+  }
+}
+
+TEST(SlotMap, TestStaleHandleAfterReuse) {
+  s21::slot_map<int> map;
+  auto a = map.insert(1);
+  map.erase(a);
+  auto b = map.insert(2);
+  ASSERT_EQ(a.index(), b.index());
+  ASSERT_NE(a.generation(), b.generation());
+  ASSERT_FALSE(map.contains(a));
+  ASSERT_EQ(map.find(a), nullptr);
+  ASSERT_EQ(map[b], 2);
+  auto copy = s21::slot_map<int>::handle::from_id(b.id());
+  ASSERT_EQ(map[copy], 2);
+}
+
+TEST(SlotMap, TestDenseIteration) {
+  s21::slot_map<int> map;
+  auto a = map.insert(1);
+  map.insert(2);
+  map.insert(3);
+  map.erase(a);
+  ASSERT_EQ(map.end() - map.begin(), 2);
+  std::vector<int> seen(map.begin(), map.end());
+  std::sort(seen.begin(), seen.end());
+  ASSERT_EQ(seen, (std::vector<int>{2, 3}));
+  for (size_t i = 0; i < map.size(); ++i) {
+    ASSERT_EQ(map[map.handle_at(i)], map.data()[i]);
+  }
+}
+
+TEST(SlotMap, TestClear) {
+  s21::slot_map<std::string> map;
+  auto a = map.insert("x");
+  map.clear();
+  ASSERT_TRUE(map.empty());
+  ASSERT_FALSE(map.contains(a));
+  auto b = map.insert("y");
+  ASSERT_EQ(b.index(), a.index());
+  ASSERT_EQ(map[b], "y");
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+
+TEST(SmallVectorMemberFunctions, TestDefault) {
+  s21::small_vector<int, 4> s21_vector;
+  EXPECT_EQ(s21_vector.size(), 0U);
+  EXPECT_TRUE(s21_vector.empty());
+  EXPECT_EQ(s21_vector.capacity(), 4U);
+  EXPECT_TRUE(s21_vector.is_inline());
+}
+
+TEST(SmallVectorMemberFunctions, TestConstructorSize) {
+  s21::small_vector<double, 4> small(3);
+  s21::small_vector<double, 4> big(10);
+  EXPECT_EQ(small.size(), 3U);
+  EXPECT_TRUE(small.is_inline());
+  EXPECT_EQ(big.size(), 10U);
+  EXPECT_FALSE(big.is_inline());
+  EXPECT_EQ(big[9], 0.0);
+}
+
+TEST(SmallVectorMemberFunctions, TestCopy) {
+  s21::small_vector<std::string, 2> inline_vector = {"a", "b"};
+  s21::small_vector<std::string, 2> heap_vector = {"a", "b", "c"};
+  s21::small_vector<std::string, 2> inline_copy = inline_vector;
+  s21::small_vector<std::string, 2> heap_copy = heap_vector;
+  EXPECT_TRUE(inline_copy.is_inline());
+  EXPECT_FALSE(heap_copy.is_inline());
+  EXPECT_EQ(inline_copy[1], "b");
+  EXPECT_EQ(heap_copy[2], "c");
+  inline_copy = heap_vector;
+  EXPECT_EQ(inline_copy.size(), 3U);
+  EXPECT_EQ(inline_copy.back(), "c");
+}
+
+TEST(SmallVectorMemberFunctions, TestMove) {
+  s21::small_vector<std::string, 2> inline_vector = {"a", "b"};
+  s21::small_vector<std::string, 2> heap_vector = {"a", "b", "c"};
+  const std::string *heap_data = heap_vector.data();
+  s21::small_vector<std::string, 2> inline_moved = std::move(inline_vector);
+  s21::small_vector<std::string, 2> heap_moved = std::move(heap_vector);
+  EXPECT_TRUE(inline_vector.empty());
+  EXPECT_TRUE(heap_vector.empty());
+  EXPECT_TRUE(heap_vector.is_inline());
+  EXPECT_TRUE(inline_moved.is_inline());
+  EXPECT_EQ(heap_moved.data(), heap_data);
+  EXPECT_EQ(inline_moved[0], "a");
+  EXPECT_EQ(heap_moved[2], "c");
+  heap_moved = std::move(inline_moved);
+  EXPECT_TRUE(heap_moved.is_inline());
+  EXPECT_EQ(heap_moved.size(), 2U);
+}
+
+TEST(SmallVectorElementAccess, TestAt) {
+  s21::small_vector<int, 4> s21_vector = {1, 2, 3};
+  EXPECT_EQ(s21_vector.at(2), 3);
+  EXPECT_THROW(s21_vector.at(3), std::out_of_range);
+}
+
+TEST(SmallVectorCapacity, TestSpill) {
+  s21::small_vector<int, 8> s21_vector;
+  std::vector<int> std_vector;
+  for (int i = 0; i < 8; ++i) {
+    s21_vector.push_back(i);
+    std_vector.push_back(i);
+  }
+  EXPECT_TRUE(s21_vector.is_inline());
+  s21_vector.push_back(s21_vector[0]);
+  std_vector.push_back(std_vector[0]);
+  EXPECT_FALSE(s21_vector.is_inline());
+  EXPECT_EQ(s21_vector.capacity(), 16U);
+  ASSERT_EQ(s21_vector.size(), std_vector.size());
+  for (size_t i = 0; i < std_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+}
+
+TEST(SmallVectorCapacity, TestReserveAndShrink) {
+  s21::small_vector<std::string, 4> s21_vector = {"a", "b"};
+  s21_vector.reserve(3);
+  EXPECT_TRUE(s21_vector.is_inline());
+  s21_vector.reserve(20);
+  EXPECT_FALSE(s21_vector.is_inline());
+  EXPECT_EQ(s21_vector.capacity(), 20U);
+  s21_vector.shrink_to_fit();
+  EXPECT_TRUE(s21_vector.is_inline());
+  EXPECT_EQ(s21_vector.capacity(), 4U);
+  EXPECT_EQ(s21_vector[1], "b");
+}
+
+TEST(SmallVectorModifier, TestInsertErase) {
+  s21::small_vector<char, 3> s21_vector = {'a', 'c'};
+  s21_vector.insert(s21_vector.begin() + 1, 'b');
+  s21_vector.insert(s21_vector.end(), 'd');
+  s21_vector.emplace(s21_vector.begin(), 'z');
+  std::vector<char> expected = {'z', 'a', 'b', 'c', 'd'};
+  ASSERT_EQ(s21_vector.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], expected[i]);
+  }
+  s21_vector.erase(s21_vector.begin());
+  s21_vector.erase(s21_vector.begin() + 1, s21_vector.begin() + 3);
+  ASSERT_EQ(s21_vector.size(), 2U);
+  EXPECT_EQ(s21_vector.front(), 'a');
+  EXPECT_EQ(s21_vector.back(), 'd');
+  EXPECT_THROW(s21_vector.erase(s21_vector.end()), std::out_of_range);
+}
+
+TEST(SmallVectorModifier, TestInsertMany) {
+  s21::small_vector<std::string, 4> s21_vector = {"a", "e"};
+  auto it = s21_vector.insert_many(s21_vector.begin() + 1, "b", "c", "d");
+  EXPECT_EQ(*it, "b");
+  s21_vector.insert_many_back("f", "g");
+  std::vector<std::string> expected = {"a", "b", "c", "d", "e", "f", "g"};
+  ASSERT_EQ(s21_vector.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], expected[i]);
+  }
+}
+
+TEST(SmallVectorModifier, TestPopAndSwap) {
+  s21::small_vector<int, 2> s21_vector_1 = {1, 2};
+  s21::small_vector<int, 2> s21_vector_2 = {3, 4, 5};
+  s21_vector_1.swap(s21_vector_2);
+  EXPECT_EQ(s21_vector_1.size(), 3U);
+  EXPECT_EQ(s21_vector_2.size(), 2U);
+  EXPECT_EQ(s21_vector_1.back(), 5);
+  EXPECT_EQ(s21_vector_2.back(), 2);
+  s21_vector_1.pop_back();
+  EXPECT_EQ(s21_vector_1.back(), 4);
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "../s21_containers.h"
+
+TEST(SoaVector, TestPushBackAndColumns) {
+  s21::soa_vector<int, double, std::string> v;
+  ASSERT_TRUE(v.empty());
+  for (int i = 0; i < 100; ++i) v.push_back(i, i * 0.5, std::to_string(i));
+  ASSERT_EQ(v.size(), 100U);
+  ASSERT_GE(v.capacity(), 100U);
+  auto ids = v.column<0>();
+  ASSERT_EQ(ids.size(), 100U);
+  ASSERT_EQ(ids[42], 42);
+  ASSERT_EQ(s21::count(ids, 7), 1U);
+  ASSERT_EQ(*s21::max_element(v.column<1>()), 49.5);
+  ASSERT_EQ(v.data<2>()[99], "99");
+  auto [id, price, name] = v[10];
+  ASSERT_EQ(id, 10);
+  ASSERT_EQ(price, 5.0);
+  ASSERT_EQ(name, "10");
+  std::get<2>(v.at(3)) = "three";
+  ASSERT_EQ(v.column<2>()[3], "three");
+  ASSERT_THROW(v.at(100), std::out_of_range);
+}
+
+TEST(SoaVector, TestRowIterators) {
+  s21::soa_vector<std::int32_t, std::int64_t> v{{1, 10}, {2, 20}, {3, 30}};
+  for (auto [a, b] : v) b += a;
+  std::int64_t sum = 0;
+  const auto &cv = v;
+  for (auto it = cv.begin(); it != cv.end(); ++it) sum += std::get<1>(*it);
+  ASSERT_EQ(sum, 66);
+  ASSERT_EQ(cv.end() - cv.begin(), 3);
+  ASSERT_EQ(std::get<0>(v.begin()[2]), 3);
+}
+
+TEST(SoaVector, TestReserveAndInsertManyBack) {
+  s21::soa_vector<std::string, int> v;
+  v.reserve(10);
+  ASSERT_EQ(v.capacity(), 10U);
+  v.insert_many_back(std::make_tuple(std::string("a"), 1),
+                     std::make_tuple(std::string("b"), 2));
+  v.push_back(std::make_tuple(std::string("c"), 3));
+  ASSERT_EQ(v.size(), 3U);
+  v.shrink_to_fit();
+  ASSERT_EQ(v.capacity(), 3U);
+  v.emplace_back("d", 4);
+  ASSERT_EQ(v.column<0>()[3], "d");
+  ASSERT_EQ(v.column<1>()[0], 1);
+  v.pop_back();
+  v.resize(5);
+  ASSERT_EQ(v.column<1>()[4], 0);
+  v.resize(1);
+  ASSERT_EQ(v.size(), 1U);
+  v.clear();
+  ASSERT_TRUE(v.empty());
+}
+
+TEST(SoaVector, TestCopyAndMove) {
+  s21::soa_vector<std::string, int> a{{"x", 1}, {"y", 2}};
+  s21::soa_vector<std::string, int> b(a);
+  std::get<0>(b[0]) = "z";
+  ASSERT_EQ(a.column<0>()[0], "x");
+  s21::soa_vector<std::string, int> c(std::move(b));
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(c.column<0>()[0], "z");
+  a = c;
+  ASSERT_EQ(a.column<0>()[0], "z");
+  b = std::move(a);
+  ASSERT_EQ(b.size(), 2U);
+  b.swap(a);
+  ASSERT_EQ(std::get<1>(a[1]), 2);
+}
+
+TEST(SoaVector, TestAppendAliasingElements) {
+  s21::soa_vector<int, std::string> v;
+  v.push_back(1, std::string(40, 'a'));
+  for (int i = 0; i < 6; ++i) {
+    v.shrink_to_fit();
+    ASSERT_EQ(v.size(), v.capacity());
+    v.emplace_back(v.column<0>()[0], v.column<1>()[0]);
+  }
+  ASSERT_EQ(v.size(), 7U);
+  v.shrink_to_fit();
+  v.insert_many_back(v[0], v[1]);
+  ASSERT_EQ(v.size(), 9U);
+  for (const auto &text : v.column<1>()) ASSERT_EQ(text, std::string(40, 'a'));
+  for (int value : v.column<0>()) ASSERT_EQ(value, 1);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus/s21_containersplus.h"
+
+TEST(Span, TestConstruction) {
+  s21::vector<int> v{1, 2, 3, 4, 5};
+  s21::span<int> from_vector(v);
+  ASSERT_EQ(from_vector.data(), v.data());
+  ASSERT_EQ(from_vector.size(), 5U);
+  from_vector[0] = 10;
+  ASSERT_EQ(v[0], 10);
+
+  s21::array<double, 4> a{1.0, 2.0, 3.0, 4.0};
+  s21::span from_array(a);
+  ASSERT_EQ(from_array.size(), 4U);
+  ASSERT_EQ(from_array.size_bytes(), 4 * sizeof(double));
+  const s21::array<double, 4> &ca = a;
+  s21::span<const double> read_only(ca);
+  ASSERT_EQ(read_only.back(), 4.0);
+
+  int raw[] = {7, 8, 9};
+  s21::span<int> from_pointer(raw, 3);
+  s21::span<int> from_range(raw, raw + 2);
+  s21::span<const int> converted(from_pointer);
+  ASSERT_EQ(from_range.size(), 2U);
+  ASSERT_EQ(converted.front(), 7);
+  ASSERT_TRUE(s21::span<int>().empty());
+}
+
+TEST(Span, TestSlicing) {
+  s21::vector<int> v(10);
+  std::iota(v.begin(), v.end(), 0);
+  s21::span<int> s(v);
+  ASSERT_EQ(s.first(3).back(), 2);
+  ASSERT_EQ(s.last(3).front(), 7);
+  ASSERT_EQ(s.subspan(4).size(), 6U);
+  ASSERT_EQ(s.subspan(4, 2).back(), 5);
+  ASSERT_TRUE(s.subspan(10).empty());
+  ASSERT_THROW(s.first(11), std::out_of_range);
+  ASSERT_THROW(s.last(11), std::out_of_range);
+  ASSERT_THROW(s.subspan(11), std::out_of_range);
+  ASSERT_THROW(s.subspan(5, 6), std::out_of_range);
+  ASSERT_THROW(s.at(10), std::out_of_range);
+}
+
+TEST(Span, TestAlgorithms) {
+  s21::vector<int> v{5, 3, 9, 1, 7, 3, 8, 2};
+  s21::sort(s21::span<int>(v).first(4));
+  ASSERT_EQ(v[0], 1);
+  ASSERT_EQ(v[3], 9);
+  ASSERT_EQ(v[4], 7);
+  ASSERT_EQ(s21::count(s21::span<int>(v).last(4), 3), 1U);
+  ASSERT_EQ(*s21::max_element(s21::span<int>(v).subspan(4)), 8);
+  s21::fill(s21::span<int>(v).last(2), 0);
+  ASSERT_EQ(v[7], 0);
+  ASSERT_TRUE(s21::equal(s21::span<int>(v).first(2), s21::vector<int>{1, 3}));
+  ASSERT_EQ(s21::parallel::reduce(s21::span<int>(v), 0), 1 + 3 + 5 + 9 + 7 + 3);
+}
+
+TEST(StridedSpan, TestColumnsOfMatrix) {
+  // 3 x 4 row-major matrix.
+  s21::vector<int> m(12);
+  std::iota(m.begin(), m.end(), 0);
+  s21::strided_span<int> column(m.data() + 1, 3, 4);
+  ASSERT_EQ(column.size(), 3U);
+  ASSERT_EQ(column[0], 1);
+  ASSERT_EQ(column[2], 9);
+  ASSERT_EQ(column.back(), 9);
+  ASSERT_EQ(std::accumulate(column.begin(), column.end(), 0), 15);
+  for (int &x : column) x = -x;
+  ASSERT_EQ(m[5], -5);
+  ASSERT_EQ(column.end() - column.begin(), 3);
+  ASSERT_EQ(column.subspan(1).front(), -5);
+  ASSERT_EQ(column.first(1).size(), 1U);
+  ASSERT_EQ(column.last(1).front(), -9);
+  ASSERT_THROW(column.at(3), std::out_of_range);
+  ASSERT_THROW(s21::strided_span<int>(m.data(), 2, 0), std::out_of_range);
+}
+
+TEST(StridedSpan, TestFromSpan) {
+  s21::array<int, 7> a{0, 1, 2, 3, 4, 5, 6};
+  s21::strided_span<int> even(s21::span<int>(a), 2);
+  ASSERT_EQ(even.size(), 4U);
+  ASSERT_EQ(even.stride(), 2U);
+  ASSERT_EQ(even.back(), 6);
+  std::sort(even.begin(), even.end(), std::greater<>());
+  ASSERT_EQ(a[0], 6);
+  ASSERT_EQ(a[1], 1);
+  ASSERT_EQ(a[6], 0);
+}
+
+TEST(Span, TestPointerAndZeroCount) {
+  int values[3] = {1, 2, 3};
+  int *p = values;
+  s21::span<int> empty(p, 0);
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.data(), p);
+  s21::span<const int> all(p, p + 3);
+  EXPECT_EQ(all.size(), 3U);
+  EXPECT_EQ(all.back(), 3);
+}
+
+TEST(StridedSpan, TestEmptyTailsStayInside) {
+  int values[1] = {7};
+  size_t huge = std::numeric_limits<size_t>::max() / sizeof(int) / 2;
+  s21::strided_span<int> s(values, 1, huge);
+  EXPECT_EQ(s.front(), 7);
+  EXPECT_TRUE(s.last(0).empty());
+  EXPECT_TRUE(s.subspan(1).empty());
+  EXPECT_TRUE(s.subspan(1, 0).empty());
+  EXPECT_EQ(s.subspan(0).front(), 7);
+  EXPECT_EQ(s.last(0).begin(), s.last(0).end());
+}
@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <iterator>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "../s21_containers.h"
+
+template <typename T, size_t K>
+bool SameElements(const s21::unrolled_list<T, K> &a, const std::list<T> &b) {
+  if (a.size() != b.size()) return false;
+  auto it = b.begin();
+  for (const T &value : a) {
+    if (!(value == *it++)) return false;
+  }
+  return true;
+}
+
+TEST(UnrolledList, TestPushAndIterate) {
+  s21::unrolled_list<int, 4> list;
+  std::list<int> expected;
+  for (int i = 0; i < 10; ++i) {
+    list.push_back(i);
+    expected.push_back(i);
+  }
+  list.push_front(-1);
+  expected.push_front(-1);
+  EXPECT_TRUE(SameElements(list, expected));
+  EXPECT_EQ(list.front(), -1);
+  EXPECT_EQ(list.back(), 9);
+  EXPECT_EQ(list.node_count(), 4U);
+  auto it = list.end();
+  for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit) {
+    ASSERT_EQ(*--it, *rit);
+  }
+  EXPECT_EQ(it, list.begin());
+}
+
+TEST(UnrolledList, TestInsertEraseInTheMiddle) {
+  s21::unrolled_list<std::string, 4> list;
+  std::list<std::string> expected;
+  unsigned seed = 7;
+  for (int i = 0; i < 500; ++i) {
+    seed = seed * 1103515245U + 12345U;
+    size_t pos = list.empty() ? 0 : (seed >> 8) % (list.size() + 1);
+    auto it = list.begin();
+    auto eit = expected.begin();
+    for (size_t k = 0; k < pos; ++k) {
+      ++it;
+      ++eit;
+    }
+    if (seed % 3 == 0 && it != list.end()) {
+      auto next = list.erase(it);
+      auto enext = expected.erase(eit);
+      if (enext != expected.end()) {
+        ASSERT_EQ(*next, *enext);
+      }
+    } else {
+      auto inserted = list.insert(it, std::to_string(i));
+      expected.insert(eit, std::to_string(i));
+      ASSERT_EQ(*inserted, std::to_string(i));
+    }
+    ASSERT_TRUE(SameElements(list, expected));
+  }
+  EXPECT_LE(list.node_count() * 4, list.size() * 2 + 8);
+  list.erase(list.begin(), list.end());
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.node_count(), 0U);
+}
+
+TEST(UnrolledList, TestPop) {
+  s21::unrolled_list<int, 3> list = {1, 2, 3, 4, 5};
+  list.pop_back();
+  list.pop_front();
+  EXPECT_EQ(list.front(), 2);
+  EXPECT_EQ(list.back(), 4);
+  EXPECT_EQ(list.size(), 3U);
+}
+
+TEST(UnrolledList, TestSplice) {
+  s21::unrolled_list<int, 4> list = {1, 2, 3, 4, 5, 6};
+  s21::unrolled_list<int, 4> other = {10, 11, 12};
+  auto pos = list.begin();
+  ++pos;
+  ++pos;
+  list.splice(pos, other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_TRUE(SameElements(list, std::list<int>{1, 2, 10, 11, 12, 3, 4, 5, 6}));
+  s21::unrolled_list<int, 4> tail = {7};
+  list.splice(list.end(), tail);
+  s21::unrolled_list<int, 4> head = {0};
+  list.splice(list.begin(), head);
+  EXPECT_EQ(list.front(), 0);
+  EXPECT_EQ(list.back(), 7);
+  EXPECT_EQ(list.size(), 11U);
+  s21::unrolled_list<int, 4> empty;
+  empty.splice(empty.end(), list);
+  EXPECT_EQ(empty.size(), 11U);
+}
+
+TEST(UnrolledList, TestSortIsStable) {
+  s21::unrolled_list<std::pair<int, int>, 5> list;
+  std::list<std::pair<int, int>> expected;
+  unsigned seed = 3;
+  for (int i = 0; i < 1000; ++i) {
+    seed = seed * 1103515245U + 12345U;
+    std::pair<int, int> item(static_cast<int>((seed >> 16) % 50U), i);
+    list.push_back(item);
+    expected.push_back(item);
+  }
+  auto by_key = [](const std::pair<int, int> &a,
+                   const std::pair<int, int> &b) { return a.first < b.first; };
+  list.sort(by_key);
+  expected.sort(by_key);
+  EXPECT_TRUE(SameElements(list, expected));
+}
+
+TEST(UnrolledList, TestCopyMoveAndCompare) {
+  s21::unrolled_list<std::string, 2> a = {"a", "b", "c"};
+  s21::unrolled_list<std::string, 2> b = a;
+  EXPECT_TRUE(a == b);
+  b.push_back("d");
+  EXPECT_TRUE(a != b);
+  s21::unrolled_list<std::string, 2> c = std::move(b);
+  EXPECT_EQ(c.size(), 4U);
+  c = a;
+  EXPECT_TRUE(c == a);
+  c.sort(std::greater<std::string>());
+  EXPECT_EQ(c.front(), "c");
+}
+
+TEST(UnrolledList, TestInsertElementOfFullNode) {
+  s21::unrolled_list<std::string, 4> list;
+  std::list<std::string> expected;
+  for (char c = 'a'; c < 'e'; ++c) {
+    list.push_back(std::string(40, c));
+    expected.push_back(std::string(40, c));
+  }
+  list.insert(list.begin(), list.back());
+  expected.insert(expected.begin(), expected.back());
+  auto pos = list.begin();
+  ++pos;
+  list.insert(pos, *pos);
+  expected.insert(++expected.begin(), *++expected.begin());
+  EXPECT_TRUE(SameElements(list, expected));
+}
+
+TEST(UnrolledList, TestEraseRanges) {
+  s21::unrolled_list<int, 4> list;
+  std::list<int> expected;
+  for (int i = 0; i < 40; ++i) {
+    list.push_back(i);
+    expected.push_back(i);
+  }
+  auto first = std::next(list.begin(), 3);
+  auto efirst = std::next(expected.begin(), 3);
+  auto last = std::next(first, 25);
+  auto elast = std::next(efirst, 25);
+  auto next = list.erase(first, last);
+  auto enext = expected.erase(efirst, elast);
+  EXPECT_EQ(*next, *enext);
+  EXPECT_TRUE(SameElements(list, expected));
+  EXPECT_LE(list.node_count(), 5U);
+  next = list.erase(list.begin(), ++list.begin());
+  expected.erase(expected.begin());
+  EXPECT_EQ(*next, expected.front());
+  next = list.erase(++list.begin(), list.end());
+  expected.erase(++expected.begin(), expected.end());
+  EXPECT_EQ(next, list.end());
+  EXPECT_TRUE(SameElements(list, expected));
+  list.erase(list.begin(), list.end());
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.node_count(), 0U);
+}
@@ -1,6 +1,13 @@
 #include <gtest/gtest.h>
+#include <sys/mman.h>
 
+#include <array>
+#include <cerrno>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <list>
+#include <sstream>
 #include <vector>
 
 #include "../s21_containers.h"
@@ -259,3 +266,443 @@ TEST(VectorModifier, TestSwap) {
   EXPECT_EQ(s21_vector_1.size(), s21_vector_4.size());
   EXPECT_EQ(s21_vector_2.size(), s21_vector_3.size());
 }
+
+struct CopyCounter {
+  static int copies;
+  int value;
+  CopyCounter(int v = 0) : value(v) {}
+  CopyCounter(const CopyCounter &other) : value(other.value) { ++copies; }
+  CopyCounter(CopyCounter &&other) noexcept : value(other.value) {}
+  CopyCounter &operator=(const CopyCounter &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  CopyCounter &operator=(CopyCounter &&other) noexcept {
+    value = other.value;
+    return *this;
+  }
+};
+
+int CopyCounter::copies = 0;
+
+TEST(VectorCapacity, TestReserveMovesElements) {
+  s21::vector<CopyCounter> s21_vector = {1, 2, 3};
+  CopyCounter::copies = 0;
+  s21_vector.reserve(100);
+  s21_vector.shrink_to_fit();
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(s21_vector.capacity(), 3U);
+  EXPECT_EQ(s21_vector[0].value, 1);
+  EXPECT_EQ(s21_vector[2].value, 3);
+}
+
+TEST(VectorCapacity, TestReserveStrings) {
+  s21::vector<std::string> s21_vector;
+  std::vector<std::string> std_vector;
+  for (int i = 0; i < 100; ++i) {
+    s21_vector.push_back(std::string(32, static_cast<char>('a' + i % 26)));
+    std_vector.push_back(std::string(32, static_cast<char>('a' + i % 26)));
+  }
+  s21_vector.shrink_to_fit();
+  EXPECT_EQ(s21_vector.size(), std_vector.size());
+  for (size_t i = 0; i < std_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+}
+
+TEST(VectorCapacity, TestShrinkToFitEmpty) {
+  s21::vector<int> s21_vector = {1, 2, 3};
+  s21_vector.clear();
+  s21_vector.shrink_to_fit();
+  EXPECT_EQ(s21_vector.capacity(), 0U);
+  s21_vector.push_back(7);
+  EXPECT_EQ(s21_vector.back(), 7);
+}
+
+TEST(VectorModifier, TestEmplaceBack) {
+  s21::vector<std::pair<int, std::string>> s21_vector;
+  std::vector<std::pair<int, std::string>> std_vector;
+  for (int i = 0; i < 10; ++i) {
+    s21_vector.emplace_back(i, std::to_string(i));
+    std_vector.emplace_back(i, std::to_string(i));
+  }
+  EXPECT_EQ(s21_vector.size(), std_vector.size());
+  for (size_t i = 0; i < std_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+}
+
+TEST(VectorModifier, TestEmplaceMoveOnly) {
+  s21::vector<std::unique_ptr<int>> s21_vector;
+  s21_vector.emplace_back(new int(1));
+  s21_vector.push_back(std::make_unique<int>(3));
+  s21_vector.emplace(s21_vector.begin() + 1, new int(2));
+  s21_vector.insert(s21_vector.begin(), std::make_unique<int>(0));
+  ASSERT_EQ(s21_vector.size(), 4U);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(*s21_vector[static_cast<size_t>(i)], i);
+  }
+}
+
+TEST(VectorModifier, TestEmplaceAliasing) {
+  s21::vector<std::string> s21_vector = {"first", "second"};
+  s21_vector.push_back(s21_vector[0]);
+  s21_vector.insert(s21_vector.begin(), s21_vector[2]);
+  s21_vector.emplace(s21_vector.begin() + 1, s21_vector.back());
+  std::vector<std::string> expected = {"first", "first", "first", "second",
+                                       "first"};
+  ASSERT_EQ(s21_vector.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], expected[i]);
+  }
+}
+
+TEST(VectorModifier, TestInsertMany) {
+  s21::vector<std::string> s21_vector = {"a", "e"};
+  auto it = s21_vector.insert_many(s21_vector.begin() + 1, "b",
+                                   std::string("c"), "d");
+  EXPECT_EQ(*it, "b");
+  std::vector<std::string> expected = {"a", "b", "c", "d", "e"};
+  ASSERT_EQ(s21_vector.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], expected[i]);
+  }
+  EXPECT_THROW(s21_vector.insert_many(s21_vector.end() + 1, "x"),
+               std::out_of_range);
+}
+
+TEST(VectorModifier, TestInsertManyBack) {
+  s21::vector<std::unique_ptr<int>> s21_vector;
+  s21_vector.insert_many_back(std::make_unique<int>(1),
+                              std::make_unique<int>(2));
+  ASSERT_EQ(s21_vector.size(), 2U);
+  EXPECT_EQ(*s21_vector[0], 1);
+  EXPECT_EQ(*s21_vector[1], 2);
+}
+
+TEST(VectorCapacity, TestInsertGrowsGeometrically) {
+  s21::vector<int> s21_vector;
+  for (int i = 0; i < 1000; ++i) {
+    s21_vector.insert(s21_vector.begin(), i);
+  }
+  EXPECT_EQ(s21_vector.size(), 1000U);
+  EXPECT_EQ(s21_vector.front(), 999);
+  EXPECT_EQ(s21_vector.back(), 0);
+  EXPECT_EQ(s21_vector.reallocations(), 11U);
+}
+
+TEST(VectorCapacity, TestInsertManyGrowsGeometrically) {
+  s21::vector<int> s21_vector;
+  for (int i = 0; i < 100; ++i) {
+    s21_vector.insert_many(s21_vector.begin(), i, i);
+    s21_vector.insert_many_back(i);
+  }
+  EXPECT_EQ(s21_vector.size(), 300U);
+  EXPECT_LE(s21_vector.reallocations(), 10U);
+}
+
+TEST(VectorCapacity, TestOneAndHalfGrowth) {
+  s21::vector<int, std::allocator<int>, s21::one_and_half_growth> s21_vector;
+  for (int i = 0; i < 5; ++i) s21_vector.push_back(i);
+  EXPECT_EQ(s21_vector.capacity(), 5U);
+  EXPECT_EQ(s21_vector.reallocations(), 4U);
+}
+
+TEST(VectorCapacity, TestSizeClassGrowth) {
+  s21::vector<int, std::allocator<int>, s21::size_class_growth> s21_vector;
+  s21_vector.push_back(1);
+  EXPECT_EQ(s21_vector.capacity(), 4U);
+  for (int i = 0; i < 100; ++i) s21_vector.push_back(i);
+  EXPECT_EQ(s21_vector.capacity() * sizeof(int) % 16, 0U);
+  EXPECT_EQ(s21_vector.back(), 99);
+}
+
+TEST(VectorCapacity, TestReserveIsExact) {
+  s21::vector<int> s21_vector = {1, 2, 3};
+  s21_vector.reserve(5);
+  EXPECT_EQ(s21_vector.capacity(), 5U);
+  EXPECT_EQ(s21_vector.reallocations(), 1U);
+}
+
+TEST(VectorModifier, TestInsertRange) {
+  std::vector<int> source = {10, 11, 12, 13, 14};
+  for (size_t index = 0; index <= 6; ++index) {
+    for (size_t extra = 0; extra <= 8; extra += 4) {
+      s21::vector<int> s21_vector = {0, 1, 2, 3, 4, 5};
+      std::vector<int> std_vector = {0, 1, 2, 3, 4, 5};
+      s21_vector.reserve(6 + extra);
+      size_t reallocations = s21_vector.reallocations();
+      auto it = s21_vector.insert(s21_vector.begin() + index, source.begin(),
+                                  source.end());
+      std_vector.insert(std_vector.begin() + static_cast<long>(index),
+                        source.begin(), source.end());
+      EXPECT_EQ(*it, 10);
+      EXPECT_LE(s21_vector.reallocations(), reallocations + 1);
+      ASSERT_EQ(s21_vector.size(), std_vector.size());
+      for (size_t i = 0; i < std_vector.size(); ++i) {
+        EXPECT_EQ(s21_vector[i], std_vector[i]);
+      }
+    }
+  }
+}
+
+TEST(VectorModifier, TestInsertRangeStrings) {
+  std::list<std::string> source = {"x", "y", "z"};
+  s21::vector<std::string> s21_vector = {"a", "b", "c", "d", "e"};
+  s21_vector.reserve(10);
+  s21_vector.insert(s21_vector.begin() + 1, source.begin(), source.end());
+  s21_vector.insert(s21_vector.begin() + 6, source.begin(), source.end());
+  std::vector<std::string> expected = {"a", "x", "y", "z", "b", "c",
+                                       "x", "y", "z", "d", "e"};
+  ASSERT_EQ(s21_vector.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], expected[i]);
+  }
+}
+
+TEST(VectorModifier, TestInsertInputRange) {
+  std::istringstream stream("4 5 6");
+  s21::vector<int> s21_vector = {1, 2, 3};
+  s21_vector.insert(s21_vector.begin() + 1, std::istream_iterator<int>(stream),
+                    std::istream_iterator<int>());
+  std::vector<int> expected = {1, 4, 5, 6, 2, 3};
+  ASSERT_EQ(s21_vector.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], expected[i]);
+  }
+}
+
+TEST(VectorModifier, TestAssign) {
+  std::vector<std::string> longer = {"a", "b", "c", "d", "e"};
+  std::vector<std::string> shorter = {"x", "y"};
+  s21::vector<std::string> s21_vector = {"1", "2", "3"};
+  s21_vector.assign(shorter.begin(), shorter.end());
+  ASSERT_EQ(s21_vector.size(), 2U);
+  EXPECT_EQ(s21_vector[1], "y");
+  s21_vector.assign(longer.begin(), longer.end());
+  ASSERT_EQ(s21_vector.size(), 5U);
+  EXPECT_EQ(s21_vector.back(), "e");
+  s21_vector.reserve(10);
+  s21_vector.assign(shorter.begin(), shorter.end());
+  s21_vector.assign(longer.begin(), longer.end());
+  EXPECT_EQ(s21_vector.capacity(), 10U);
+  EXPECT_EQ(s21_vector.front(), "a");
+  EXPECT_EQ(s21_vector.back(), "e");
+}
+
+TEST(VectorModifier, TestAppendRange) {
+  s21::vector<int> s21_vector = {1, 2};
+  std::array<int, 3> tail = {3, 4, 5};
+  s21_vector.append_range(tail);
+  s21_vector.append_range(std::vector<int>{6});
+  ASSERT_EQ(s21_vector.size(), 6U);
+  for (size_t i = 0; i < s21_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], static_cast<int>(i + 1));
+  }
+}
+
+TEST(VectorModifier, TestResize) {
+  s21::vector<std::string> s21_vector = {"a", "b", "c"};
+  std::vector<std::string> std_vector = {"a", "b", "c"};
+  s21_vector.resize(6, "z");
+  std_vector.resize(6, "z");
+  s21_vector.resize(8);
+  std_vector.resize(8);
+  ASSERT_EQ(s21_vector.size(), std_vector.size());
+  for (size_t i = 0; i < std_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+  s21_vector.resize(2);
+  EXPECT_EQ(s21_vector.size(), 2U);
+  EXPECT_EQ(s21_vector.back(), "b");
+  EXPECT_GE(s21_vector.capacity(), 8U);
+}
+
+TEST(VectorModifier, TestResizeAliasing) {
+  s21::vector<std::string> s21_vector = {"first"};
+  s21_vector.resize(4, s21_vector[0]);
+  for (size_t i = 0; i < s21_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], "first");
+  }
+}
+
+TEST(VectorModifier, TestResizeForOverwrite) {
+  s21::vector<int> s21_vector = {1, 2};
+  s21_vector.resize_for_overwrite(1000);
+  EXPECT_EQ(s21_vector.size(), 1000U);
+  EXPECT_EQ(s21_vector[0], 1);
+  EXPECT_EQ(s21_vector[1], 2);
+  for (size_t i = 0; i < s21_vector.size(); ++i) {
+    s21_vector[i] = static_cast<int>(i);
+  }
+  EXPECT_EQ(s21_vector.back(), 999);
+  s21_vector.resize_for_overwrite(10);
+  EXPECT_EQ(s21_vector.size(), 10U);
+
+  s21::vector<std::string> strings;
+  strings.resize_for_overwrite(3);
+  EXPECT_TRUE(strings[2].empty());
+}
+
+TEST(VectorModifier, TestEraseRange) {
+  s21::vector<std::string> s21_vector = {"a", "b", "c", "d", "e"};
+  std::vector<std::string> std_vector = {"a", "b", "c", "d", "e"};
+  auto it = s21_vector.erase(s21_vector.begin() + 1, s21_vector.begin() + 3);
+  std_vector.erase(std_vector.begin() + 1, std_vector.begin() + 3);
+  EXPECT_EQ(*it, "d");
+  ASSERT_EQ(s21_vector.size(), std_vector.size());
+  for (size_t i = 0; i < std_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+  it = s21_vector.erase(s21_vector.begin(), s21_vector.begin());
+  EXPECT_EQ(s21_vector.size(), 3U);
+  it = s21_vector.erase(s21_vector.begin(), s21_vector.end());
+  EXPECT_TRUE(s21_vector.empty());
+  EXPECT_EQ(it, s21_vector.end());
+  EXPECT_THROW(s21_vector.erase(s21_vector.begin(), s21_vector.end() + 1),
+               std::out_of_range);
+}
+
+TEST(VectorModifier, TestEraseIf) {
+  s21::vector<int> s21_vector;
+  for (int i = 0; i < 100000; ++i) s21_vector.push_back(i);
+  auto removed =
+      s21::erase_if(s21_vector, [](int value) { return value % 3 != 0; });
+  EXPECT_EQ(removed, 66666U);
+  ASSERT_EQ(s21_vector.size(), 33334U);
+  for (size_t i = 0; i < s21_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], static_cast<int>(i * 3));
+  }
+}
+
+template <typename T, bool Propagate>
+struct TrackingAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment =
+      std::integral_constant<bool, Propagate>;
+  using propagate_on_container_move_assignment =
+      std::integral_constant<bool, Propagate>;
+  using propagate_on_container_swap = std::integral_constant<bool, Propagate>;
+
+  int id;
+  std::shared_ptr<size_t> allocations;
+
+  explicit TrackingAllocator(int allocator_id)
+      : id(allocator_id), allocations(std::make_shared<size_t>(0)) {}
+
+  template <typename U>
+  TrackingAllocator(const TrackingAllocator<U, Propagate> &other)
+      : id(other.id), allocations(other.allocations) {}
+
+  T *allocate(size_t n) {
+    ++*allocations;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  bool operator==(const TrackingAllocator &other) const {
+    return id == other.id;
+  }
+  bool operator!=(const TrackingAllocator &other) const {
+    return id != other.id;
+  }
+};
+
+TEST(VectorAllocator, TestUsesAllocator) {
+  TrackingAllocator<std::string, false> alloc(1);
+  s21::vector<std::string, TrackingAllocator<std::string, false>> s21_vector(
+      alloc);
+  for (int i = 0; i < 10; ++i) s21_vector.push_back(std::to_string(i));
+  EXPECT_EQ(*alloc.allocations, s21_vector.reallocations());
+  EXPECT_EQ(s21_vector.get_allocator().id, 1);
+
+  s21::vector<std::string, TrackingAllocator<std::string, false>> copy =
+      s21_vector;
+  EXPECT_EQ(copy.get_allocator().id, 1);
+  EXPECT_EQ(*alloc.allocations, s21_vector.reallocations() + 1);
+  EXPECT_EQ(copy[9], "9");
+}
+
+TEST(VectorAllocator, TestNonPropagatingAssignment) {
+  using Alloc = TrackingAllocator<std::string, false>;
+  s21::vector<std::string, Alloc> s21_vector_1({"a", "b", "c"}, Alloc(1));
+  s21::vector<std::string, Alloc> s21_vector_2({"x"}, Alloc(2));
+  s21_vector_2 = s21_vector_1;
+  EXPECT_EQ(s21_vector_2.get_allocator().id, 2);
+  EXPECT_EQ(s21_vector_2.back(), "c");
+
+  s21::vector<std::string, Alloc> s21_vector_3({"y"}, Alloc(3));
+  s21_vector_3 = std::move(s21_vector_1);
+  EXPECT_EQ(s21_vector_3.get_allocator().id, 3);
+  EXPECT_EQ(*s21_vector_3.get_allocator().allocations, 2U);
+  ASSERT_EQ(s21_vector_3.size(), 3U);
+  EXPECT_EQ(s21_vector_3[1], "b");
+  EXPECT_TRUE(s21_vector_1.empty());
+}
+
+TEST(VectorAllocator, TestPropagatingAssignment) {
+  using Alloc = TrackingAllocator<int, true>;
+  s21::vector<int, Alloc> s21_vector_1({1, 2, 3}, Alloc(1));
+  s21::vector<int, Alloc> s21_vector_2({4}, Alloc(2));
+  s21_vector_2 = s21_vector_1;
+  EXPECT_EQ(s21_vector_2.get_allocator().id, 1);
+  EXPECT_EQ(s21_vector_2.back(), 3);
+
+  s21::vector<int, Alloc> s21_vector_3({5}, Alloc(3));
+  int *data = s21_vector_1.data();
+  s21_vector_3 = std::move(s21_vector_1);
+  EXPECT_EQ(s21_vector_3.get_allocator().id, 1);
+  EXPECT_EQ(s21_vector_3.data(), data);
+
+  s21_vector_3.swap(s21_vector_2);
+  EXPECT_EQ(s21_vector_2.get_allocator().id, 1);
+  EXPECT_EQ(s21_vector_3.get_allocator().id, 1);
+}
+
+TEST(VectorAllocator, TestHugePages) {
+  constexpr std::size_t kHugePage = s21::huge_pages::page_size;
+  s21::huge_page_vector<int> s21_vector(10);
+  s21_vector.reserve(kHugePage / sizeof(int) + 1);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(s21_vector.data()) % kHugePage,
+            0U);
+  for (int i = 0; i < 1000000; ++i) s21_vector.push_back(i);
+  EXPECT_EQ(s21_vector.size(), 1000010U);
+  EXPECT_EQ(s21_vector[10], 0);
+  EXPECT_EQ(s21_vector.back(), 999999);
+  s21_vector.resize(5);
+  s21_vector.shrink_to_fit();
+  EXPECT_EQ(s21_vector.capacity(), 5U);
+  EXPECT_EQ(s21_vector[4], 0);
+}
+
+TEST(VectorAllocator, TestHugePagesPrefault) {
+  s21::huge_page_vector<char, s21::huge_pages::populate> populated;
+  populated.resize(3 * s21::huge_pages::page_size, 'x');
+  EXPECT_EQ(populated[populated.size() - 1], 'x');
+
+  std::vector<double, s21::huge_page_allocator<double>> std_vector(1 << 20,
+                                                                   1.5);
+  EXPECT_EQ(std_vector.back(), 1.5);
+}
+
+TEST(VectorAllocator, TestHugePagesLock) {
+  // A huge page is larger than the default RLIMIT_MEMLOCK of many systems.
+  constexpr std::size_t kHugePage = s21::huge_pages::page_size;
+  void *probe = ::mmap(nullptr, kHugePage, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  ASSERT_NE(probe, MAP_FAILED);
+  bool lockable = ::mlock(probe, kHugePage) == 0;
+  int error = errno;
+  ::munmap(probe, kHugePage);
+  if (!lockable && (error == EPERM || error == ENOMEM)) {
+    GTEST_SKIP() << "RLIMIT_MEMLOCK is below one huge page";
+  }
+  ASSERT_TRUE(lockable);
+
+  s21::huge_page_vector<char, s21::huge_pages::lock> locked;
+  locked.reserve(kHugePage);
+  locked.push_back('y');
+  EXPECT_EQ(locked.front(), 'y');
+}